@@ -0,0 +1,116 @@
+# Lance chaque instance de bench/instances.txt avec chaque algorithme et plusieurs graines, puis écrit les
+# comptes rendus dans OUTPUT_DIR :
+#   - bench.jsonl : un objet JSON par exécution (avec la trace du meilleur coût au cours du temps) ;
+#   - bench.csv   : les mêmes mesures sans la trace, une ligne par exécution.
+#
+# Variables (passées avec -D) :
+#   EXE         l'exécutable mh_project (obligatoire) ;
+#   SOURCE_DIR  la racine du projet (obligatoire) ;
+#   OUTPUT_DIR  le dossier des résultats (obligatoire) ;
+#   SEEDS       le nombre de graines par couple instance/algorithme (défaut : 3) ;
+#   TIME_LIMIT  le temps maximum de chaque exécution en secondes (défaut : 10) ;
+#   SOLVERS     la liste des algorithmes séparés par des points-virgules (défaut : pipeline;tabucol;tempering) ;
+#   USE_CACHE   ON pour charger les graphes avec --cache (défaut : OFF) ;
+#   ORDERINGS   la liste des renumérotations passées à --reorder (défaut : none) ;
+#   PERF        l'exécutable perf : si défini, chaque exécution est mesurée par "perf stat" et les colonnes
+#               cacheMisses et cacheReferences du CSV sont remplies (NA sinon).
+
+foreach (required EXE SOURCE_DIR OUTPUT_DIR)
+    if (NOT DEFINED ${required})
+        message(FATAL_ERROR "RunBench.cmake : la variable ${required} doit être définie.")
+    endif ()
+endforeach ()
+if (NOT DEFINED SEEDS)
+    set(SEEDS 3)
+endif ()
+if (NOT DEFINED TIME_LIMIT)
+    set(TIME_LIMIT 10)
+endif ()
+if (NOT DEFINED SOLVERS)
+    set(SOLVERS pipeline tabucol tempering)
+endif ()
+if (NOT DEFINED ORDERINGS)
+    set(ORDERINGS none)
+endif ()
+set(cacheArgument "")
+if (USE_CACHE)
+    set(cacheArgument --cache)
+endif ()
+
+set(jsonFile "${OUTPUT_DIR}/bench.jsonl")
+set(csvFile "${OUTPUT_DIR}/bench.csv")
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+file(REMOVE "${jsonFile}")
+set(perfFile "${OUTPUT_DIR}/perf.txt")
+set(cacheMisses "")
+set(cacheReferences "")
+
+file(STRINGS "${SOURCE_DIR}/bench/instances.txt" instanceLines REGEX "^[^#]" ENCODING UTF-8)
+foreach (line IN LISTS instanceLines)
+    string(REGEX MATCH "^([^ \t]+)[ \t]+([0-9]+)" matched "${line}")
+    if (NOT matched)
+        message(FATAL_ERROR "Ligne invalide dans bench/instances.txt : ${line}")
+    endif ()
+    set(instance "${SOURCE_DIR}/graphs/${CMAKE_MATCH_1}")
+    set(k "${CMAKE_MATCH_2}")
+    set(name "${CMAKE_MATCH_1}")
+    foreach (ordering IN LISTS ORDERINGS)
+        foreach (solver IN LISTS SOLVERS)
+            foreach (seed RANGE 1 ${SEEDS})
+                message(STATUS "bench : ${name} k=${k} ${solver} graine ${seed} renumerotation ${ordering}")
+                set(command "${EXE}" --file "${instance}" --k ${k} --solver ${solver} --seed ${seed}
+                        --timeLimit ${TIME_LIMIT} --report "${jsonFile}" --reorder ${ordering} ${cacheArgument})
+                if (DEFINED PERF)
+                    set(command "${PERF}" stat -x , -e cache-misses,cache-references -o "${perfFile}" -- ${command})
+                endif ()
+                execute_process(
+                        COMMAND ${command}
+                        RESULT_VARIABLE result
+                        OUTPUT_QUIET)
+                if (NOT result EQUAL 0)
+                    message(FATAL_ERROR "Échec de l'exécution sur ${instance} avec ${solver} (code ${result}).")
+                endif ()
+
+                # Compteurs matériels de perf stat (une ligne "valeur,unité,événement,..." par événement)
+                set(misses NA)
+                set(references NA)
+                if (DEFINED PERF)
+                    file(STRINGS "${perfFile}" perfLines)
+                    foreach (perfLine IN LISTS perfLines)
+                        if (perfLine MATCHES "^([0-9]+),[^,]*,cache-misses")
+                            set(misses "${CMAKE_MATCH_1}")
+                        elseif (perfLine MATCHES "^([0-9]+),[^,]*,cache-references")
+                            set(references "${CMAKE_MATCH_1}")
+                        endif ()
+                    endforeach ()
+                endif ()
+                list(APPEND cacheMisses "${misses}")
+                list(APPEND cacheReferences "${references}")
+            endforeach ()
+        endforeach ()
+    endforeach ()
+endforeach ()
+
+# Conversion en CSV (la trace n'est conservée que dans le fichier JSON)
+set(columns instance k solver seed ordering bandwidth meanNeighborGap numNodes numEdges loadTime greedyConflicts
+        timeToLegal bestConflicts totalTime iterations iterationsPerSecond acceptedMoves uphillMoves acceptanceRate
+        peakRssKb)
+string(REPLACE ";" "," csv "${columns};cacheMisses;cacheReferences")
+string(APPEND csv "\n")
+file(STRINGS "${jsonFile}" reports ENCODING UTF-8)
+set(run 0)
+foreach (report IN LISTS reports)
+    set(values "")
+    foreach (column IN LISTS columns)
+        string(JSON value GET "${report}" ${column})
+        list(APPEND values "${value}")
+    endforeach ()
+    list(GET cacheMisses ${run} misses)
+    list(GET cacheReferences ${run} references)
+    list(APPEND values "${misses}" "${references}")
+    math(EXPR run "${run} + 1")
+    string(REPLACE ";" "," row "${values}")
+    string(APPEND csv "${row}\n")
+endforeach ()
+file(WRITE "${csvFile}" "${csv}")
+message(STATUS "bench : résultats écrits dans ${jsonFile} et ${csvFile}")
@@ -0,0 +1,104 @@
+# Étude de passage à l'échelle : génère avec mh_generator un graphe synthétique pour chaque couple taille/degré
+# moyen, lance mh_project dessus puis écrit les comptes rendus dans OUTPUT_DIR :
+#   - scaling.jsonl : un objet JSON par exécution ;
+#   - scaling.csv   : une ligne par exécution (temps de chargement, mémoire maximale, itérations par seconde, ...).
+#
+# Variables (passées avec -D) :
+#   EXE         l'exécutable mh_project (obligatoire) ;
+#   GENERATOR   l'exécutable mh_generator (obligatoire) ;
+#   OUTPUT_DIR  le dossier des résultats et des graphes générés (obligatoire) ;
+#   TYPE        la famille des graphes : gnp, leighton ou flat (défaut : gnp) ;
+#   SIZES       la liste des nombres de noeuds (défaut : 1000;10000;100000) ;
+#   DEGREES     la liste des degrés moyens (défaut : 8;32;128) ;
+#   K           le nombre de couleurs cherché, et de classes cachées pour leighton et flat (défaut : 10) ;
+#   SOLVER      l'algorithme lancé (défaut : tabucol) ;
+#   TIME_LIMIT  le temps maximum de chaque exécution en secondes (défaut : 10) ;
+#   FORMAT      le format des graphes générés : col (DIMACS) ou csr (cache binaire) (défaut : col) ;
+#   SEED        la graine du générateur et de l'algorithme (défaut : 1).
+
+foreach (required EXE GENERATOR OUTPUT_DIR)
+    if (NOT DEFINED ${required})
+        message(FATAL_ERROR "RunScaling.cmake : la variable ${required} doit être définie.")
+    endif ()
+endforeach ()
+if (NOT DEFINED TYPE)
+    set(TYPE gnp)
+endif ()
+if (NOT DEFINED SIZES)
+    set(SIZES 1000 10000 100000)
+endif ()
+if (NOT DEFINED DEGREES)
+    set(DEGREES 8 32 128)
+endif ()
+if (NOT DEFINED K)
+    set(K 10)
+endif ()
+if (NOT DEFINED SOLVER)
+    set(SOLVER tabucol)
+endif ()
+if (NOT DEFINED TIME_LIMIT)
+    set(TIME_LIMIT 10)
+endif ()
+if (NOT DEFINED FORMAT)
+    set(FORMAT col)
+endif ()
+if (NOT DEFINED SEED)
+    set(SEED 1)
+endif ()
+
+set(jsonFile "${OUTPUT_DIR}/scaling.jsonl")
+set(csvFile "${OUTPUT_DIR}/scaling.csv")
+set(graphDir "${OUTPUT_DIR}/graphs")
+file(MAKE_DIRECTORY "${graphDir}")
+file(REMOVE "${jsonFile}")
+set(runDegrees "")
+
+foreach (size IN LISTS SIZES)
+    foreach (degree IN LISTS DEGREES)
+        # Le graphe n'est généré qu'une fois : à graine fixe, il ne dépend que de ses paramètres
+        set(graph "${graphDir}/${TYPE}_n${size}_d${degree}_k${K}_s${SEED}.${FORMAT}")
+        if (NOT EXISTS "${graph}")
+            message(STATUS "scaling : generation ${TYPE} n=${size} degre ${degree}")
+            execute_process(
+                    COMMAND "${GENERATOR}" --type ${TYPE} --n ${size} --degree ${degree} --k ${K} --seed ${SEED}
+                    --output "${graph}"
+                    RESULT_VARIABLE result
+                    OUTPUT_QUIET)
+            if (NOT result EQUAL 0)
+                message(FATAL_ERROR "Échec de la génération de ${graph} (code ${result}).")
+            endif ()
+        endif ()
+
+        message(STATUS "scaling : ${TYPE} n=${size} degre ${degree} k=${K} ${SOLVER}")
+        execute_process(
+                COMMAND "${EXE}" --file "${graph}" --k ${K} --solver ${SOLVER} --seed ${SEED}
+                --timeLimit ${TIME_LIMIT} --report "${jsonFile}"
+                RESULT_VARIABLE result
+                OUTPUT_QUIET)
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Échec de l'exécution sur ${graph} avec ${SOLVER} (code ${result}).")
+        endif ()
+        list(APPEND runDegrees "${degree}")
+    endforeach ()
+endforeach ()
+
+# Conversion en CSV (la trace n'est conservée que dans le fichier JSON)
+set(columns numNodes numEdges loadTime peakRssKb iterations iterationsPerSecond greedyConflicts bestConflicts
+        totalTime)
+string(REPLACE ";" "," csv "type;degree;${columns}")
+string(APPEND csv "\n")
+file(STRINGS "${jsonFile}" reports ENCODING UTF-8)
+set(run 0)
+foreach (report IN LISTS reports)
+    list(GET runDegrees ${run} degree)
+    set(values "${TYPE}" "${degree}")
+    foreach (column IN LISTS columns)
+        string(JSON value GET "${report}" ${column})
+        list(APPEND values "${value}")
+    endforeach ()
+    math(EXPR run "${run} + 1")
+    string(REPLACE ";" "," row "${values}")
+    string(APPEND csv "${row}\n")
+endforeach ()
+file(WRITE "${csvFile}" "${csv}")
+message(STATUS "scaling : résultats écrits dans ${jsonFile} et ${csvFile}")
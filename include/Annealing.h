@@ -0,0 +1,638 @@
+/**
+ * @file Annealing.h
+ * @brief Définit le noyau générique du recuit simulé, paramétré par le générateur aléatoire, le schéma de
+ * refroidissement et le type de mouvement, ainsi que ses briques : générateur xoshiro256**, flux de nombres
+ * aléatoires tirés par lots et table des probabilités d'acceptation.
+ */
+
+#ifndef ANNEALING_H
+#define ANNEALING_H
+
+#include "Graph.h"
+#include "SearchStats.h"
+#include "RunBudget.h"
+#include "Checkpoint.h"
+#include "KempeChain.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Xoshiro256
+ * @brief Générateur xoshiro256** (Blackman & Vigna) : 32 octets d'état, quelques cycles par tirage de 64 bits.
+ * Satisfait les exigences de UniformRandomBitGenerator.
+ */
+class Xoshiro256 {
+public:
+    using result_type = std::uint64_t;
+
+    /**
+     * @brief Constructeur de la classe Xoshiro256, l'état est initialisé par splitmix64 à partir de la graine.
+     * @param seed La graine du générateur.
+     */
+    explicit Xoshiro256(std::uint64_t seed = 0);
+
+    static constexpr result_type min() { return 0; }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * @return Un entier de 64 bits uniformément distribué.
+     */
+    result_type operator()() {
+        std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Écrit l'état du générateur sous forme textuelle, comme les générateurs de la bibliothèque standard.
+     * @param out Le flux de sortie.
+     * @param engine Le générateur.
+     * @return Le flux de sortie.
+     */
+    friend std::ostream& operator<<(std::ostream& out, const Xoshiro256& engine);
+
+    /**
+     * @brief Relit un état écrit par operator<<.
+     * @param in Le flux d'entrée.
+     * @param engine Le générateur, inchangé si la lecture échoue.
+     * @return Le flux d'entrée.
+     */
+    friend std::istream& operator>>(std::istream& in, Xoshiro256& engine);
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int shift) {
+        return (x << shift) | (x >> (64 - shift));
+    }
+
+    std::uint64_t state[4]; // L'état du générateur.
+};
+
+/**
+ * @class RandomStream
+ * @brief Flux de nombres aléatoires de 32 bits tirés par lots de BATCH_SIZE dans un tampon.
+ *
+ * Le remplissage du tampon est une boucle serrée sans dépendance avec le reste de l'itération ; un tirage de 64 bits
+ * fournit deux valeurs. Les entiers dans [0, n) sont obtenus par multiplication et décalage (sans division) et les
+ * réels dans [0, 1) par une multiplication.
+ *
+ * @tparam Engine Le générateur (xoshiro256**, std::mt19937, ...).
+ */
+template <class Engine>
+class RandomStream {
+public:
+    static constexpr int BATCH_SIZE = 256; // Le nombre de valeurs de 32 bits par lot.
+
+    /**
+     * @brief Constructeur de la classe RandomStream.
+     * @param seed La graine du générateur.
+     */
+    explicit RandomStream(std::uint64_t seed) : engine(static_cast<typename Engine::result_type>(seed)) {}
+
+    /**
+     * @return Une valeur de 32 bits uniformément distribuée.
+     */
+    std::uint32_t next() {
+        if (position == BATCH_SIZE) {
+            refill();
+        }
+        return buffer[position++];
+    }
+
+    /**
+     * @param n La borne, strictement positive.
+     * @return Un entier dans [0, n).
+     */
+    int below(int n) {
+        return static_cast<int>((static_cast<std::uint64_t>(next()) * static_cast<std::uint32_t>(n)) >> 32);
+    }
+
+    /**
+     * @return Un réel dans [0, 1).
+     */
+    double unit() {
+        return next() * (1.0 / 4294967296.0);
+    }
+
+    /**
+     * @return L'état du flux (générateur, lot courant et position dans le lot) sous forme textuelle.
+     */
+    [[nodiscard]] std::string saveState() const {
+        std::ostringstream out;
+        out << engine << ' ' << position;
+        for (std::uint32_t value : buffer) {
+            out << ' ' << value;
+        }
+        return out.str();
+    }
+
+    /**
+     * @brief Restaure un état écrit par saveState : les tirages suivants sont identiques à ceux du flux d'origine.
+     * @param state L'état du flux.
+     * @throw std::invalid_argument si l'état ne peut pas être relu.
+     */
+    void restoreState(const std::string& state) {
+        std::istringstream in(state);
+        Engine restoredEngine;
+        int restoredPosition = 0;
+        std::array<std::uint32_t, BATCH_SIZE> restoredBuffer{};
+        in >> restoredEngine >> restoredPosition;
+        for (std::uint32_t& value : restoredBuffer) {
+            in >> value;
+        }
+        if (!in || restoredPosition < 0 || restoredPosition > BATCH_SIZE) {
+            throw std::invalid_argument("État du générateur aléatoire invalide.");
+        }
+        engine = restoredEngine;
+        position = restoredPosition;
+        buffer = restoredBuffer;
+    }
+
+private:
+    /**
+     * @brief Remplit le tampon avec un nouveau lot de valeurs.
+     */
+    void refill() {
+        if constexpr (Engine::max() - Engine::min() > 0xFFFFFFFFull) {
+            for (int i = 0; i < BATCH_SIZE; i += 2) {
+                std::uint64_t bits = engine();
+                buffer[i] = static_cast<std::uint32_t>(bits);
+                buffer[i + 1] = static_cast<std::uint32_t>(bits >> 32);
+            }
+        } else {
+            for (int i = 0; i < BATCH_SIZE; i++) {
+                buffer[i] = static_cast<std::uint32_t>(engine());
+            }
+        }
+        position = 0;
+    }
+
+    Engine engine; // Le générateur.
+    std::array<std::uint32_t, BATCH_SIZE> buffer{}; // Le lot courant.
+    int position = BATCH_SIZE; // La position de la prochaine valeur dans buffer.
+};
+
+/**
+ * @class AcceptanceTable
+ * @brief Seuils d'acceptation de Metropolis exp(-delta / T) pour les petites variations entières de coût.
+ *
+ * Les variations d'une coloration sont de petits entiers : les seuils sont calculés à la demande au plus une fois
+ * par variation et par température, sous forme d'entiers de 32 bits directement comparables à RandomStream::next.
+ * Les variations au-delà de MAX_DELTA sont calculées à chaque fois.
+ */
+class AcceptanceTable {
+public:
+    static constexpr int MAX_DELTA = 64; // La plus grande variation conservée dans la table.
+
+    /**
+     * @brief Change la température, les seuils déjà calculés sont invalidés.
+     * @param temperature La nouvelle température, strictement positive.
+     */
+    void setTemperature(double temperature) {
+        currentTemperature = temperature;
+        epoch++;
+    }
+
+    /**
+     * @return La température courante.
+     */
+    [[nodiscard]] double temperature() const {
+        return currentTemperature;
+    }
+
+    /**
+     * @brief Tire au sort l'acceptation d'un mouvement.
+     * @param delta La variation du nombre de conflits.
+     * @param stream Le flux aléatoire, aucun nombre n'est tiré si delta <= 0.
+     * @return true si le mouvement est accepté.
+     */
+    template <class Stream>
+    bool accept(int delta, Stream& stream) {
+        if (delta <= 0) {
+            return true;
+        }
+        return stream.next() < threshold(delta);
+    }
+
+private:
+    /**
+     * @param delta La variation du nombre de conflits, strictement positive.
+     * @return exp(-delta / T) * 2^32.
+     */
+    std::uint64_t threshold(int delta) {
+        if (delta > MAX_DELTA) {
+            return computeThreshold(delta);
+        }
+        if (stamp[delta] != epoch) {
+            thresholds[delta] = computeThreshold(delta);
+            stamp[delta] = epoch;
+        }
+        return thresholds[delta];
+    }
+
+    /**
+     * @param delta La variation du nombre de conflits.
+     * @return exp(-delta / T) * 2^32.
+     */
+    [[nodiscard]] std::uint64_t computeThreshold(int delta) const;
+
+    double currentTemperature = 1; // La température courante.
+    std::uint64_t epoch = 1; // Incrémenté à chaque changement de température.
+    std::array<std::uint64_t, MAX_DELTA + 1> thresholds{}; // Les seuils calculés.
+    std::array<std::uint64_t, MAX_DELTA + 1> stamp{}; // L'époque à laquelle chaque seuil a été calculé.
+};
+
+/**
+ * @class GeometricCooling
+ * @brief Refroidissement géométrique : la température est multipliée par rate toutes les period itérations.
+ */
+class GeometricCooling {
+public:
+    /**
+     * @brief Constructeur de la classe GeometricCooling.
+     * @param initTemp La température initiale.
+     * @param rate Le coefficient de refroidissement.
+     * @param period Le nombre d'itérations entre deux refroidissements.
+     * @throw std::invalid_argument si initTemp <= 0, si rate n'est pas dans ]0, 1] ou si period < 1.
+     */
+    GeometricCooling(double initTemp, double rate, int period = 10);
+
+    /**
+     * @return La température courante.
+     */
+    [[nodiscard]] double temperature() const {
+        return currentTemperature;
+    }
+
+    /**
+     * @brief Fait avancer le schéma d'une itération.
+     * @param iteration Le numéro de l'itération qui vient de se terminer.
+     * @return true si la température a changé.
+     */
+    bool step(long long iteration) {
+        if (iteration % period != 0) {
+            return false;
+        }
+        currentTemperature *= rate;
+        return true;
+    }
+
+    /**
+     * @brief Remplace la température courante (reprise d'une trajectoire).
+     * @param temperature La température.
+     */
+    void setTemperature(double temperature) {
+        currentTemperature = temperature;
+    }
+
+private:
+    double currentTemperature; // La température courante.
+    double rate; // Le coefficient de refroidissement.
+    int period; // Le nombre d'itérations entre deux refroidissements.
+};
+
+/**
+ * @class RecolorMove
+ * @brief Mouvement de recoloration : numChanges noeuds (tirés parmi tous les noeuds ou parmi les noeuds en conflit)
+ * reçoivent chacun une couleur différente de leur couleur courante.
+ *
+ * Avec un seul changement, le mouvement est seulement évalué (recolorDelta) et n'est appliqué que s'il est accepté.
+ * Avec plusieurs changements, chaque recoloration dépend des précédentes : le mouvement est appliqué en place et
+ * enregistré dans un journal d'annulation réutilisé d'un mouvement à l'autre.
+ */
+class RecolorMove {
+public:
+    /**
+     * @brief Constructeur de la classe RecolorMove.
+     * @param k Le nombre de couleur utilisable, au moins 2.
+     * @param numChanges Le nombre de noeuds recoloriés par mouvement, au moins 1.
+     * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+     * @throw std::invalid_argument si k < 2 ou si numChanges < 1.
+     */
+    RecolorMove(int k, int numChanges, bool conflictSampling);
+
+    /**
+     * @brief Tire un mouvement aléatoire et calcule sa variation du nombre de conflits.
+     * @param solution La solution courante, modifiée seulement si numChanges > 1.
+     * @param stream Le flux aléatoire.
+     * @return La variation du nombre de conflits.
+     */
+    template <class Stream>
+    int propose(Graph& solution, Stream& stream) {
+        undoLog.clear();
+        if (numChanges == 1) {
+            if (!draw(solution, stream)) {
+                return 0;
+            }
+            return solution.recolorDelta(pendingNode, pendingColor);
+        }
+        int delta = 0;
+        for (int change = 0; change < numChanges; change++) {
+            if (!draw(solution, stream)) {
+                break;
+            }
+            delta += solution.recolorDelta(pendingNode, pendingColor);
+            undoLog.emplace_back(pendingNode, solution.getColor(pendingNode));
+            solution.recolorNode(pendingNode, pendingColor);
+        }
+        pendingNode = -1;
+        return delta;
+    }
+
+    /**
+     * @brief Conserve le dernier mouvement proposé.
+     * @param solution La solution courante.
+     */
+    void commit(Graph& solution) {
+        if (pendingNode >= 0) {
+            solution.recolorNode(pendingNode, pendingColor);
+        }
+    }
+
+    /**
+     * @brief Abandonne le dernier mouvement proposé.
+     * @param solution La solution courante.
+     */
+    void reject(Graph& solution) {
+        for (auto it = undoLog.rbegin(); it != undoLog.rend(); ++it) {
+            solution.recolorNode(it->first, it->second);
+        }
+    }
+
+private:
+    /**
+     * @brief Tire un noeud et une nouvelle couleur, rangés dans pendingNode et pendingColor.
+     * @param solution La solution courante.
+     * @param stream Le flux aléatoire.
+     * @return false si aucun noeud ne peut être tiré (plus aucun noeud en conflit).
+     */
+    template <class Stream>
+    bool draw(const Graph& solution, Stream& stream) {
+        if (conflictSampling) {
+            const std::vector<int>& conflicting = solution.getConflictingNodes();
+            if (conflicting.empty()) {
+                pendingNode = -1;
+                return false;
+            }
+            pendingNode = conflicting[stream.below(static_cast<int>(conflicting.size()))];
+        } else {
+            pendingNode = stream.below(solution.getNumNodes());
+        }
+        // Tirage parmi les k-1 couleurs différentes de la couleur courante
+        pendingColor = stream.below(k - 1);
+        if (pendingColor >= solution.getColor(pendingNode)) {
+            pendingColor++;
+        }
+        return true;
+    }
+
+    int k; // Le nombre de couleur utilisable.
+    int numChanges; // Le nombre de noeuds recoloriés par mouvement.
+    bool conflictSampling; // true pour ne tirer que des noeuds en conflit.
+    int pendingNode = -1; // Le noeud du mouvement en attente (un seul changement), -1 si aucun.
+    int pendingColor = 0; // La nouvelle couleur du mouvement en attente.
+    std::vector<std::pair<int, int>> undoLog; // Journal d'annulation : (noeud, ancienne couleur).
+};
+
+/**
+ * @class KempeMove
+ * @brief Voisinage mixte : avec la probabilité kempeRate, échange des couleurs d'une chaîne de Kempe (noeud tiré
+ * comme pour RecolorMove, seconde couleur tirée parmi les k-1 autres), sinon mouvement de recoloration.
+ *
+ * L'échange d'une chaîne de Kempe n'augmente jamais le nombre de conflits : il est toujours accepté et permet de
+ * changer la couleur de nombreux noeuds sur les plateaux où les recolorations d'un seul noeud stagnent. La chaîne
+ * est calculée et évaluée sans modifier la solution, puis appliquée seulement lors du commit.
+ */
+class KempeMove {
+public:
+    /**
+     * @brief Constructeur de la classe KempeMove.
+     * @param k Le nombre de couleur utilisable, au moins 2.
+     * @param numNodes Le nombre de noeuds du graphe.
+     * @param numChanges Le nombre de noeuds recoloriés par mouvement de recoloration, au moins 1.
+     * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+     * @param kempeRate La probabilité d'un échange de chaîne de Kempe, dans [0, 1].
+     * @throw std::invalid_argument si k < 2, si numChanges < 1 ou si kempeRate n'est pas dans [0, 1].
+     */
+    KempeMove(int k, int numNodes, int numChanges, bool conflictSampling, double kempeRate);
+
+    /**
+     * @brief Tire un mouvement aléatoire et calcule sa variation du nombre de conflits.
+     * @param solution La solution courante, modifiée seulement par une recoloration avec numChanges > 1.
+     * @param stream Le flux aléatoire.
+     * @return La variation du nombre de conflits.
+     */
+    template <class Stream>
+    int propose(Graph& solution, Stream& stream) {
+        pendingKempe = stream.next() < kempeThreshold;
+        if (!pendingKempe) {
+            return recolor.propose(solution, stream);
+        }
+        int v;
+        if (conflictSampling) {
+            const std::vector<int>& conflicting = solution.getConflictingNodes();
+            if (conflicting.empty()) {
+                pendingKempe = false;
+                return 0;
+            }
+            v = conflicting[stream.below(static_cast<int>(conflicting.size()))];
+        } else {
+            v = stream.below(solution.getNumNodes());
+        }
+        int otherColor = stream.below(k - 1);
+        if (otherColor >= solution.getColor(v)) {
+            otherColor++;
+        }
+        return chain.build(solution, v, otherColor);
+    }
+
+    /**
+     * @brief Conserve le dernier mouvement proposé.
+     * @param solution La solution courante.
+     */
+    void commit(Graph& solution) {
+        if (pendingKempe) {
+            chain.apply(solution);
+        } else {
+            recolor.commit(solution);
+        }
+    }
+
+    /**
+     * @brief Abandonne le dernier mouvement proposé.
+     * @param solution La solution courante.
+     */
+    void reject(Graph& solution) {
+        if (!pendingKempe) {
+            recolor.reject(solution);
+        }
+    }
+
+private:
+    RecolorMove recolor; // Le mouvement de recoloration.
+    KempeChain chain; // La chaîne de Kempe du mouvement en attente (tampons réutilisés).
+    int k; // Le nombre de couleur utilisable.
+    bool conflictSampling; // true pour ne tirer que des noeuds en conflit.
+    std::uint64_t kempeThreshold; // kempeRate * 2^32, comparé à RandomStream::next.
+    bool pendingKempe = false; // true si le mouvement en attente est un échange de chaîne de Kempe.
+};
+
+/**
+ * @struct AnnealingResult
+ * @brief Résultat d'une trajectoire du recuit simulé.
+ */
+struct AnnealingResult {
+    std::vector<int> bestColoring; // La meilleure coloration rencontrée.
+    int bestCost = 0; // Le nombre de conflits de la meilleure coloration.
+    long long indexBestSol = 0; // L'itération de la meilleure solution.
+    long long bestSolTime = 0; // Le temps (en secondes) de la meilleure solution.
+    long long indexLastChange = 0; // L'itération du dernier changement de solution courante.
+    double finalTemperature = 0; // La température finale.
+    long long iterations = 0; // Le nombre d'itérations effectuées.
+    StopReason stopReason = StopReason::None; // La raison de l'arrêt de la trajectoire.
+    SearchStats stats; // Les mesures de la trajectoire.
+};
+
+/**
+ * @brief Copie l'état d'une trajectoire du recuit simulé et le confie au thread d'écriture des points de reprise.
+ * @param checkpoints Le thread d'écriture des points de reprise.
+ * @param next La prochaine itération à effectuer.
+ * @param temperature La température courante.
+ * @param result Le résultat en cours de la trajectoire (meilleure solution et compteurs).
+ * @param currentSol La solution courante.
+ * @param stream Le flux aléatoire.
+ */
+template <class Stream>
+void submitCheckpoint(CheckpointWriter& checkpoints, long long next, double temperature, const AnnealingResult& result,
+                      const Graph& currentSol, const Stream& stream) {
+    AnnealingCheckpoint state;
+    state.iteration = next;
+    state.temperature = temperature;
+    state.bestCost = result.bestCost;
+    state.indexBestSol = result.indexBestSol;
+    state.indexLastChange = result.indexLastChange;
+    state.acceptedMoves = result.stats.acceptedMoves;
+    state.uphillMoves = result.stats.uphillMoves;
+    state.currentColoring = currentSol.getColoring();
+    state.bestColoring = result.bestColoring;
+    state.rngState = stream.saveState();
+    checkpoints.submit(std::move(state));
+}
+
+/**
+ * @brief Une trajectoire du recuit simulé, appliquée en place sur currentSol.
+ *
+ * Chaque itération propose un mouvement, tire son acceptation dans la table des seuils puis le conserve (commit)
+ * ou l'abandonne (reject). La meilleure solution est conservée sous forme de tableau de couleurs, le graphe n'est
+ * donc jamais copié pendant les itérations. La trajectoire s'arrête lorsque le budget est épuisé (temps, itérations,
+ * coût cible ou annulation) et rend sa meilleure solution.
+ *
+ * Si checkpoints est non nul, l'état de la trajectoire est copié toutes les getPeriod() secondes (au plus, l'horloge
+ * n'étant lue que tous les SearchStats::SAMPLE_PERIOD itérations) et à l'arrêt, puis écrit par le thread
+ * d'écriture. Une trajectoire reprise à partir d'un de ces états est identique, mouvement pour mouvement, à la
+ * trajectoire d'origine ; le nombre maximum d'itérations du budget porte sur la trajectoire complète.
+ *
+ * @tparam Engine Le générateur aléatoire.
+ * @tparam Cooling Le schéma de refroidissement (temperature(), step(iteration) et setTemperature(t)).
+ * @tparam Move Le type de mouvement (propose(solution, stream), commit(solution) et reject(solution)).
+ * @param currentSol La solution courante, modifiée en place.
+ * @param cooling Le schéma de refroidissement.
+ * @param move Le mouvement.
+ * @param budget Le budget de la trajectoire.
+ * @param seed La graine du générateur aléatoire.
+ * @param onTarget Jeton annulé par la trajectoire lorsqu'elle atteint le coût cible (pour arrêter les trajectoires
+ * voisines qui l'utilisent dans leur budget). Peut être nul.
+ * @param resume L'état à partir duquel la trajectoire reprend, nul pour partir de currentSol.
+ * @param checkpoints Le thread d'écriture des points de reprise, nul pour ne pas en écrire.
+ * @return Le résultat de la trajectoire.
+ */
+template <class Engine, class Cooling, class Move>
+AnnealingResult annealingKernel(Graph& currentSol, Cooling cooling, Move move, RunBudget budget, std::uint64_t seed,
+                                CancellationToken* onTarget = nullptr, const AnnealingCheckpoint* resume = nullptr,
+                                CheckpointWriter* checkpoints = nullptr) {
+    AnnealingResult result;
+    RandomStream<Engine> stream(seed);
+    long long i = 0;
+    if (resume != nullptr) {
+        currentSol.setColoring(resume->currentColoring);
+        stream.restoreState(resume->rngState);
+        cooling.setTemperature(resume->temperature);
+        i = resume->iteration;
+        result.indexBestSol = resume->indexBestSol;
+        result.indexLastChange = resume->indexLastChange;
+        result.stats.acceptedMoves = resume->acceptedMoves;
+        result.stats.uphillMoves = resume->uphillMoves;
+    }
+    int currentCost = currentSol.countConflicts();
+    result.bestColoring = resume != nullptr ? resume->bestColoring : currentSol.getColoring();
+    result.bestCost = resume != nullptr ? resume->bestCost : currentCost;
+    result.stats.recordBest(0, result.bestCost);
+
+    AcceptanceTable acceptance;
+    acceptance.setTemperature(cooling.temperature());
+
+    auto startTime = std::chrono::steady_clock::now();
+    double nextCheckpoint = checkpoints != nullptr ? checkpoints->getPeriod() : 0;
+    for (; !budget.shouldStop(i, result.bestCost); i++) {
+        int delta = move.propose(currentSol, stream);
+        if (acceptance.accept(delta, stream)) {
+            move.commit(currentSol);
+            currentCost += delta;
+            result.indexLastChange = i;
+            result.stats.acceptedMoves++;
+            if (delta > 0) {
+                result.stats.uphillMoves++;
+            }
+            if (currentCost < result.bestCost) {
+                result.bestColoring = currentSol.getColoring();
+                result.bestCost = currentCost;
+                result.indexBestSol = i;
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+                result.bestSolTime = static_cast<long long>(elapsed);
+                result.stats.recordBest(elapsed, currentCost);
+                if (currentCost <= budget.getTargetCost() && onTarget != nullptr) {
+                    // Coût cible atteint : les autres trajectoires peuvent s'arrêter
+                    onTarget->cancel();
+                }
+            }
+        } else {
+            move.reject(currentSol);
+        }
+
+        if (cooling.step(i)) {
+            acceptance.setTemperature(cooling.temperature());
+        }
+        if (i % SearchStats::SAMPLE_PERIOD == 0) {
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            result.stats.sample(elapsed, cooling.temperature(), currentCost);
+            if (checkpoints != nullptr && elapsed >= nextCheckpoint) {
+                submitCheckpoint(*checkpoints, i + 1, cooling.temperature(), result, currentSol, stream);
+                nextCheckpoint = elapsed + checkpoints->getPeriod();
+            }
+        }
+    }
+    if (checkpoints != nullptr) {
+        submitCheckpoint(*checkpoints, i, cooling.temperature(), result, currentSol, stream);
+    }
+    result.iterations = i;
+    result.finalTemperature = cooling.temperature();
+    result.stopReason = budget.reason();
+    result.stats.iterations = i;
+    result.stats.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+
+#endif
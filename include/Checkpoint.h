@@ -0,0 +1,146 @@
+/**
+ * @file Checkpoint.h
+ * @brief Définit le point de reprise du recuit simulé (colorations, température, itération et état du générateur),
+ * son format binaire et l'écriture périodique en arrière-plan.
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct GraphSource
+ * @brief Identité du graphe d'une trajectoire au-delà de sa taille : le fichier dont il est lu et la renumérotation
+ * de ses noeuds. Une coloration reprise sur un autre fichier ou dans un autre ordre ne correspond plus aux noeuds.
+ */
+struct GraphSource {
+    std::int64_t size = -1; // La taille du fichier source, -1 si le graphe n'a pas de fichier source.
+    std::int64_t time = 0; // La date de modification du fichier source.
+    std::string ordering = "none"; // Le nom de la renumérotation des noeuds ("none" si aucune).
+};
+
+/**
+ * @struct AnnealingCheckpoint
+ * @brief État complet d'une trajectoire du recuit simulé à la fin d'une itération : la reprise à partir de cet état,
+ * avec les mêmes paramètres, produit exactement la même suite de mouvements que la trajectoire d'origine.
+ */
+struct AnnealingCheckpoint {
+    // Paramètres de la trajectoire, vérifiés à la reprise (sauf la graine, remplacée par l'état du générateur)
+    int numEdges = 0; // Le nombre d'arêtes du graphe.
+    GraphSource source; // Le fichier source du graphe et la renumérotation de ses noeuds.
+    int k = 0; // Le nombre de couleur utilisable.
+    std::uint64_t seed = 0; // La graine initiale du générateur.
+    std::string engine; // Le nom du générateur ("xoshiro" ou "mt19937").
+    double initTemp = 0; // La température initiale.
+    double coolingRate = 0; // Le coefficient de refroidissement.
+    int nbChanges = 0; // Le nombre de changement de couleur dans le voisinage.
+    double kempeRate = 0; // La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+    bool conflictSampling = false; // true si seuls les noeuds en conflit sont tirés.
+    // État de la trajectoire
+    long long iteration = 0; // La prochaine itération à effectuer.
+    double temperature = 0; // La température courante.
+    int bestCost = 0; // Le nombre de conflits de la meilleure coloration.
+    long long indexBestSol = 0; // L'itération de la meilleure solution.
+    long long indexLastChange = 0; // L'itération du dernier changement de solution courante.
+    long long acceptedMoves = 0; // Le nombre de mouvements acceptés.
+    long long uphillMoves = 0; // Le nombre de mouvements acceptés qui augmentent le nombre de conflits.
+    std::vector<int> currentColoring; // La coloration courante.
+    std::vector<int> bestColoring; // La meilleure coloration rencontrée.
+    std::string rngState; // L'état sérialisé du flux aléatoire (générateur et lot en cours).
+};
+
+/**
+ * @brief Écrit un point de reprise dans un fichier binaire.
+ *
+ * Le fichier est d'abord écrit sous un nom temporaire puis renommé : en cas d'arrêt brutal pendant l'écriture, le
+ * point de reprise précédent reste intact.
+ *
+ * @param checkpoint Le point de reprise.
+ * @param filename Le nom du fichier.
+ * @throw std::runtime_error si le fichier ne peut pas être écrit.
+ */
+void writeCheckpoint(const AnnealingCheckpoint& checkpoint, const std::string& filename);
+
+/**
+ * @brief Lit un point de reprise écrit par writeCheckpoint.
+ * @param filename Le nom du fichier.
+ * @return Le point de reprise.
+ * @throw std::runtime_error si le fichier ne peut pas être lu ou n'est pas un point de reprise valide.
+ */
+AnnealingCheckpoint readCheckpoint(const std::string& filename);
+
+/**
+ * @class CheckpointWriter
+ * @brief Écrit les points de reprise dans un thread dédié : la trajectoire ne fait que copier son état, la
+ * sérialisation et l'écriture sur disque se font en dehors de la boucle du recuit.
+ *
+ * Un seul point de reprise est en attente : s'il n'est pas encore écrit lorsqu'un nouveau arrive, il est remplacé.
+ */
+class CheckpointWriter {
+public:
+    /**
+     * @brief Constructeur de la classe CheckpointWriter, démarre le thread d'écriture.
+     * @param filename Le nom du fichier de reprise.
+     * @param periodSeconds Le temps minimum (en secondes) entre deux points de reprise.
+     * @param parameters Les paramètres de la trajectoire (graphe, k, graine, générateur et paramètres du recuit),
+     * recopiés dans chaque point de reprise ; les champs de l'état sont ignorés.
+     * @throw std::invalid_argument si periodSeconds <= 0.
+     */
+    CheckpointWriter(std::string filename, double periodSeconds, AnnealingCheckpoint parameters);
+
+    /**
+     * @brief Destructeur de la classe CheckpointWriter, écrit le point de reprise en attente puis arrête le thread.
+     */
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    /**
+     * @brief Confie un point de reprise au thread d'écriture, sans attendre son écriture.
+     * @param checkpoint L'état de la trajectoire, les paramètres (graphe, k, graine, générateur, recuit) sont
+     * complétés.
+     */
+    void submit(AnnealingCheckpoint checkpoint);
+
+    /**
+     * @brief Attend que le point de reprise en attente soit écrit.
+     */
+    void flush();
+
+    /**
+     * @return Le temps minimum (en secondes) entre deux points de reprise.
+     */
+    [[nodiscard]] double getPeriod() const;
+
+    /**
+     * @return Le nombre de points de reprise écrits.
+     */
+    [[nodiscard]] long long getWritten() const;
+
+private:
+    /**
+     * @brief Boucle du thread d'écriture.
+     */
+    void writeLoop();
+
+    std::string filename; // Le nom du fichier de reprise.
+    double periodSeconds; // Le temps minimum entre deux points de reprise.
+    AnnealingCheckpoint parameters; // Les paramètres de la trajectoire, sans état.
+    mutable std::mutex mutex; // Protège les membres suivants.
+    std::condition_variable changed; // Signalé à chaque dépôt, écriture ou arrêt.
+    AnnealingCheckpoint pending; // Le point de reprise en attente.
+    bool hasPending = false; // true si pending n'est pas encore écrit.
+    bool writing = false; // true pendant une écriture.
+    bool stopping = false; // true lorsque le thread doit s'arrêter.
+    long long written = 0; // Le nombre de points de reprise écrits.
+    std::thread thread; // Le thread d'écriture.
+};
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @file CliqueBound.h
+ * @brief Définit le calcul d'une borne inférieure du nombre chromatique par recherche d'une grande clique :
+ * heuristique gloutonne, puis recherche exacte bornée sur des ensembles de bits.
+ */
+
+#ifndef CLIQUEBOUND_H
+#define CLIQUEBOUND_H
+
+#include "Graph.h"
+#include <vector>
+
+/**
+ * @struct CliqueBound
+ * @brief Résultat de la recherche de clique : les noeuds d'une clique forment une borne inférieure du nombre
+ * chromatique (ils doivent tous recevoir des couleurs différentes).
+ */
+struct CliqueBound {
+    static constexpr int MAX_EXACT_NODES = 8192; // La taille maximum du sous-graphe de la recherche exacte.
+
+    std::vector<int> clique; // Les noeuds de la plus grande clique trouvée.
+    bool exact = false; // true si la recherche exacte a prouvé que la clique est maximum.
+    long long nodes = 0; // Le nombre de noeuds de l'arbre de la recherche exacte.
+
+    /**
+     * @return La borne inférieure du nombre chromatique (la taille de la clique).
+     */
+    [[nodiscard]] int lowerBound() const {
+        return static_cast<int>(clique.size());
+    }
+};
+
+/**
+ * @brief Cherche une grande clique par une heuristique gloutonne.
+ *
+ * Depuis chaque noeud (par degré décroissant), la clique est étendue avec les voisins de plus grand degré adjacents
+ * à tous ses noeuds. Les noeuds de degré trop faible pour améliorer la meilleure clique sont ignorés.
+ *
+ * @param graph Le graphe.
+ * @return La plus grande clique trouvée.
+ */
+std::vector<int> greedyClique(const Graph& graph);
+
+/**
+ * @brief Calcule une borne inférieure du nombre chromatique.
+ *
+ * La clique de l'heuristique gloutonne est améliorée par une recherche exacte (séparation et évaluation, borne par
+ * coloration gloutonne, ensembles de bits) limitée à maxNodes noeuds de l'arbre de recherche. Seuls les noeuds dont
+ * le numéro de coeur (dégénérescence) est au moins la taille de la clique courante peuvent l'améliorer : la
+ * recherche exacte porte sur ce sous-graphe, et n'est pas lancée s'il dépasse CliqueBound::MAX_EXACT_NODES noeuds.
+ *
+ * @param graph Le graphe.
+ * @param maxNodes Le nombre maximum de noeuds de l'arbre de la recherche exacte, 0 pour l'heuristique seule.
+ * @return La plus grande clique trouvée et si elle est prouvée maximum.
+ */
+CliqueBound cliqueLowerBound(const Graph& graph, long long maxNodes);
+
+#endif
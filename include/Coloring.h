@@ -0,0 +1,49 @@
+/**
+ * @file Coloring.h
+ * @brief Définit les heuristiques constructives de coloration (glouton et DSATUR) et la suppression d'une classe de
+ * couleur utilisée par la descente sur k.
+ */
+
+#ifndef COLORING_H
+#define COLORING_H
+
+#include "Graph.h"
+
+/**
+ * @brief Colorie le graphe avec un algorithme glouton en utilisant au plus k couleurs.
+ *
+ * @param graph Le graphe à colorier.
+ * @param k Le nombre maximal de couleurs à utiliser.
+ */
+void greedyColoring(Graph& graph, int k);
+
+/**
+ * @brief Colorie le graphe avec l'heuristique DSATUR en utilisant au plus k couleurs.
+ *
+ * À chaque étape, le noeud non colorié de plus grand degré de saturation (nombre de couleurs différentes parmi ses
+ * voisins) est colorié, les égalités étant départagées par le degré dans le sous-graphe non colorié. Les noeuds
+ * sont rangés dans une file à seaux indexée par la clé (saturation + 1) * (degré maximum + 1) + degré non colorié :
+ * les seaux sont des listes doublement chaînées, un noeud change donc de seau en O(1). Les couleurs du voisinage de
+ * chaque noeud forment un ensemble trié de paires (couleur, nombre de voisins) rangé dans deg(v) cases contiguës :
+ * la mémoire est en O(n + m) quel que soit k, et colorier un noeud coûte O(saturation) plus une insertion dans
+ * l'ensemble de chacun de ses voisins. Les noeuds dont les voisins utilisent déjà les k couleurs sont coloriés en
+ * dernier, avec la couleur la moins représentée parmi leurs voisins.
+ *
+ * @param graph Le graphe à colorier.
+ * @param k Le nombre maximal de couleurs à utiliser.
+ */
+void dsaturColoring(Graph& graph, int k);
+
+/**
+ * @brief Supprime une classe de couleur d'une coloration à k + 1 couleurs pour obtenir un point de départ à k
+ * couleurs.
+ *
+ * La plus petite classe est supprimée : chacun de ses noeuds reçoit la couleur restante qui provoque le moins de
+ * conflits, puis la couleur k est renumérotée avec l'indice de la classe supprimée.
+ *
+ * @param graph Le graphe colorié avec les couleurs [0, k].
+ * @param k Le nombre de couleurs après la suppression.
+ */
+void removeColorClass(Graph& graph, int k);
+
+#endif
@@ -11,13 +11,69 @@
 #include <stdexcept>
 #include <chrono>
 #include <random>
+#include <utility>
+#include <memory>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @struct NeighborRange
+ * @brief Vue contiguë (non propriétaire) sur les voisins d'un noeud dans la table d'adjacence CSR du graphe.
+ */
+struct NeighborRange {
+    const int* first; // Pointeur vers le premier voisin.
+    const int* last; // Pointeur juste après le dernier voisin.
+
+    [[nodiscard]] const int* begin() const { return first; }
+    [[nodiscard]] const int* end() const { return last; }
+    [[nodiscard]] int size() const { return static_cast<int>(last - first); }
+};
+
+/**
+ * @struct Topology
+ * @brief Topologie immuable d'un graphe : table d'adjacence CSR et, pour les graphes denses, matrice de bits.
+ *
+ * Une topologie est construite une seule fois au chargement puis partagée (en lecture seule) par toutes les
+ * solutions qui la référencent, quel que soit le thread.
+ */
+struct Topology {
+    std::vector<int> offsets; // Les voisins de i sont neighbors[offsets[i] .. offsets[i+1]).
+    std::vector<int> neighbors; // Tableau contigu des voisins de tous les noeuds.
+    std::vector<std::uint64_t> bits; // Matrice d'adjacence (words mots par ligne), vide si le graphe est creux.
+    int words = 0; // Nombre de mots de 64 bits par ligne de la matrice.
+};
 
 /**
  * @class Graph
  * @brief Représente un graphe composé de noeuds et d'arêtes.
+ *
+ * Un Graph associe une topologie partagée (Topology) à un état de coloration stocké sous forme de tableaux
+ * contigus : la couleur de chaque noeud sur un type étroit (Color), le nombre de conflits de chaque noeud et
+ * l'ensemble des noeuds en conflit. Copier un Graph ne copie donc que ces tableaux (quelques Ko), jamais la table
+ * d'adjacence.
+ *
+ * Lorsque la densité du graphe dépasse DENSE_THRESHOLD, l'adjacence est aussi stockée sous forme de matrice de bits
+ * et chaque classe de couleur est maintenue sous forme d'ensemble de bits : le nombre de voisins d'une couleur
+ * donnée devient un ET bit à bit suivi d'un popcount.
  */
 class Graph {
 public:
+    /**
+     * Densité (2m / (n(n-1))) à partir de laquelle la représentation dense est construite.
+     */
+    static constexpr double DENSE_THRESHOLD = 0.1;
+
+    /**
+     * Type des couleurs stockées. Une couleur c est stockée sous la forme c + 1, la valeur 0 désignant un noeud sans
+     * couleur : la lecture de la couleur se fait sans branchement.
+     */
+    using Color = std::uint16_t;
+
+    /**
+     * Nombre maximum de couleurs distinctes (couleurs [0, MAX_COLORS-1]).
+     */
+    static constexpr int MAX_COLORS = std::numeric_limits<Color>::max() - 1;
+
     /**
      * @brief Constructeur de la classe Graph.
      * @param numNodes Le nombre de noeuds dans le graphe.
@@ -25,11 +81,36 @@ public:
      */
     explicit Graph(int numNodes);
 
+    /**
+     * @brief Constructeur de la classe Graph à partir d'une liste d'arêtes.
+     * La table d'adjacence est construite une seule fois au format CSR (un tableau d'offsets et un tableau
+     * contigu de voisins).
+     * @param numNodes Le nombre de noeuds dans le graphe.
+     * @param edges La liste des arêtes (u, v) avec des ID dans [0, numNodes-1].
+     * @throw std::invalid_argument si numNodes est négatif ou si une arête est hors de la plage valide.
+     */
+    Graph(int numNodes, const std::vector<std::pair<int, int>>& edges);
+
+    /**
+     * @brief Constructeur de la classe Graph à partir d'une table d'adjacence CSR déjà construite.
+     * @param adjOffsets Les offsets CSR (taille numNodes + 1).
+     * @param adjacency Le tableau contigu des voisins.
+     * @throw std::invalid_argument si la table d'adjacence est incohérente.
+     */
+    Graph(std::vector<int> adjOffsets, std::vector<int> adjacency);
+
+    /**
+     * @brief Constructeur d'une coloration vide sur une topologie existante, qui est partagée et non copiée.
+     * @param topology La topologie.
+     * @throw std::invalid_argument si topology est nul.
+     */
+    explicit Graph(std::shared_ptr<const Topology> topology);
+
     /**
      * @brief Constructeur par défaut de la classe Graph.
      * Initialise le graphe avec un nombre de nœuds égal à zéro.
      */
-    Graph() : numNodes(0) {}
+    Graph() : Graph(0) {}
 
     /**
      * @brief Met à jour le tableau conflictCount en entier avec la colorisation actuelle du graphe.
@@ -44,61 +125,111 @@ public:
     void setConflictCount(std::vector<int> conflictVector);
 
     /**
-     * @brief Ajoute une arête entre deux noeuds du graphe.
-     * @param u L'ID du premier noeud.
-     * @param v L'ID du deuxième noeud.
-     * @throw std::invalid_argument si u ou v sont en dehors de la plage [0, numNodes-1].
+     * @return Le nombre de noeuds dans le graphe.
      */
-    void addEdge(int u, int v);
+    [[nodiscard]] int getNumNodes() const;
 
     /**
-     * @return Le nombre de noeuds dans le graphe.
+     * @return Le nombre d'arêtes dans le graphe.
      */
-    [[nodiscard]] int getNumNodes() const;
+    [[nodiscard]] int getNumEdges() const;
+
+    /**
+     * @brief Obtient les voisins d'un noeud sous forme de plage contiguë.
+     * @param id L'ID du noeud.
+     * @return Une vue sur les ID des voisins du noeud.
+     */
+    [[nodiscard]] NeighborRange getNeighbors(int id) const {
+        return {neighborsData + offsetsData[id], neighborsData + offsetsData[id + 1]};
+    }
+
+    /**
+     * @return true si le graphe utilise la représentation dense (matrice de bits).
+     */
+    [[nodiscard]] bool isDense() const;
+
+    /**
+     * @brief Compte les voisins d'un noeud ayant une couleur donnée.
+     * En représentation dense, le calcul se fait par ET bit à bit et popcount sur la classe de couleur.
+     * @param id L'ID du noeud.
+     * @param color La couleur.
+     * @return Le nombre de voisins de couleur color.
+     */
+    [[nodiscard]] int countNeighborsWithColor(int id, int color) const;
+
+    /**
+     * @return La topologie partagée du graphe.
+     */
+    [[nodiscard]] const std::shared_ptr<const Topology>& getTopology() const;
+
+    /**
+     * @return Les offsets CSR de la table d'adjacence (taille numNodes + 1).
+     */
+    [[nodiscard]] const std::vector<int>& getAdjOffsets() const;
+
+    /**
+     * @return Le tableau contigu des voisins de la table d'adjacence.
+     */
+    [[nodiscard]] const std::vector<int>& getAdjacency() const;
+
+    /**
+     * @param id L'ID du noeud.
+     * @return Le degré du noeud.
+     */
+    [[nodiscard]] int getDegree(int id) const {
+        return offsetsData[id + 1] - offsetsData[id];
+    }
+
+    /**
+     * @brief Obtient la couleur d'un noeud.
+     * @param id L'ID du noeud.
+     * @return La couleur du noeud, -1 si le noeud n'a pas de couleur.
+     */
+    [[nodiscard]] int getColor(int id) const {
+        return static_cast<int>(colors[id]) - 1;
+    }
 
     /**
      * @brief Obtient un noeud spécifique du graphe.
      * @param id L'ID du noeud à récupérer.
-     * @return Une référence vers le noeud.
+     * @return Le noeud (ID et couleur courante).
      * @throw std::out_of_range si id est en dehors de la plage [0, numNodes-1].
      */
-    [[nodiscard]] const Node& getNode(int id) const;
+    [[nodiscard]] Node getNode(int id) const;
 
     /**
-     * @brief Obtient un vecteur de noeuds du graphe.
-     * @return Une référence vers le vecteur de noeuds.
+     * @brief Obtient un vecteur de conflit pour chaque noeud.
+     * Le vecteur n'est modifiable qu'à travers les méthodes du graphe, qui maintiennent l'ensemble des noeuds en
+     * conflit et le nombre total de conflits.
+     * @return Une référence constante vers le vecteur de conflits.
      */
-    std::vector<Node>& getNodes();
+    [[nodiscard]] const std::vector<int>& getConflictCount() const;
 
     /**
-     * @brief Obtient un vecteur de conflit pour chaque noeud.
-     * @return Une référence vers le vecteur de conflits.
+     * @brief Obtient les noeuds actuellement en conflit (conflictCount > 0), dans un ordre quelconque.
+     * @return Une référence constante vers l'ensemble des noeuds en conflit.
      */
-    std::vector<int>& getConflictCount();
+    [[nodiscard]] const std::vector<int>& getConflictingNodes() const;
 
     /**
-     * @brief Obtient un vecteur de noeuds du graphe (constante).
-     * @return Une référence constante vers le vecteur de noeuds.
+     * @brief Tire uniformément un noeud parmi les noeuds en conflit, en O(1).
+     * @param rng Générateur de nombres aléatoires.
+     * @return L'ID du noeud tiré, -1 si aucun noeud n'est en conflit.
      */
-    [[nodiscard]] const std::vector<Node>& getNodes() const;
+    int randomConflictingNode(std::mt19937& rng) const;
 
     /**
-     * @brief Calcule le nombre de conflits dans le graphe.
+     * @brief Obtient le nombre de conflits dans le graphe, maintenu de manière incrémentale (O(1)).
      * @return Le nombre de conflits (sommets voisins ayant la même couleur).
      */
     [[nodiscard]] int countConflicts() const;
 
     /**
-     * @brief Ajoute un noeud au graphe.
-     * @param n le noeud à ajouter.
-     */
-    void addNode(const Node& n);
-
-    /**
-     * @brief Crée une copie en profondeur du graphe.
-     * @return Une nouvelle instance de Graph copiée en profondeur.
+     * @brief Crée une copie de la coloration du graphe (couleurs et conflits).
+     * La topologie, immuable, est partagée avec la copie.
+     * @return Une nouvelle instance de Graph.
      */
-    [[nodiscard]] Graph clone();
+    [[nodiscard]] Graph clone() const;
 
     /**
      * @brief Affiche le contenu du graphe, y compris les noeuds, leurs couleurs et leurs voisins.
@@ -109,14 +240,103 @@ public:
      * @brief Change aléatoirement la couleur de plusieurs noeuds différents.
      * @param numChange Nombre de noeud à changer.
      * @param k Le nombre de couleur différents.
-     * @param rng Générateur de nombres aléatoires (avec une valeur par défaut).
+     * @param rng Générateur de nombres aléatoires, avancé par les tirages.
+     * @param onlyConflicting true pour ne tirer que des noeuds en conflit.
+     * @return Le nombre de noeuds effectivement recoloriés.
+     */
+    int recolorAllNodes(int numChange, int k, std::mt19937& rng, bool onlyConflicting = false);
+
+    /**
+     * @brief Calcule la variation du nombre de conflits si le noeud prenait une nouvelle couleur, sans
+     * modifier le graphe.
+     * @param id L'ID du noeud.
+     * @param newColor La couleur envisagée.
+     * @return La variation du nombre de conflits (négative si le changement améliore la solution).
+     */
+    [[nodiscard]] int recolorDelta(int id, int newColor) const;
+
+    /**
+     * @brief Change la couleur d'un noeud et met à jour conflictCount de manière incrémentale en O(degré).
+     * Le noeud peut ne pas encore avoir de couleur (-1).
+     * @param id L'ID du noeud.
+     * @param newColor La nouvelle couleur, dans [0, MAX_COLORS-1].
+     */
+    void recolorNode(int id, int newColor);
+
+    /**
+     * @brief Retire la couleur de tous les noeuds (-1) et remet conflictCount à zéro.
+     */
+    void clearColoring();
+
+    /**
+     * @brief Obtient la couleur de chaque noeud.
+     * @return Le vecteur des couleurs indexé par l'ID des noeuds.
      */
-    void recolorAllNodes(int numChange, int k, std::mt19937 rng);
+    [[nodiscard]] std::vector<int> getColoring() const;
+
+    /**
+     * @brief Applique une coloration complète au graphe et recalcule conflictCount.
+     * @param coloring Le vecteur des couleurs indexé par l'ID des noeuds.
+     * @throw std::invalid_argument si la taille du vecteur ne correspond pas au nombre de noeuds ou si une couleur est
+     * hors de [-1, MAX_COLORS-1].
+     */
+    void setColoring(const std::vector<int>& coloring);
 
 private:
+    /**
+     * @brief Agrandit les ensembles de bits des classes de couleur pour contenir la couleur donnée.
+     * @param color La couleur.
+     */
+    void ensureColorClass(int color);
+
+    /**
+     * @brief Reconstruit les ensembles de bits des classes de couleur à partir des couleurs des noeuds.
+     */
+    void rebuildColorClasses();
+
+    /**
+     * @brief Ajoute un conflit à un noeud et l'insère dans l'ensemble des noeuds en conflit si besoin.
+     * @param id L'ID du noeud.
+     */
+    void incrementConflict(int id);
+
+    /**
+     * @brief Retire un conflit à un noeud et le retire de l'ensemble des noeuds en conflit si besoin.
+     * @param id L'ID du noeud.
+     */
+    void decrementConflict(int id);
+
+    /**
+     * @brief Reconstruit l'ensemble des noeuds en conflit et le nombre total de conflits à partir de conflictCount.
+     */
+    void rebuildConflictingSet();
+
+    /**
+     * @brief Installe une nouvelle table d'adjacence CSR.
+     * Les voisins de chaque noeud sont triés, les doublons et les boucles (u, u) retirés.
+     * @param offsets Les offsets CSR (taille numNodes + 1).
+     * @param neighbors Le tableau contigu des voisins.
+     */
+    void setAdjacency(std::vector<int> offsets, std::vector<int> neighbors);
+
+    /**
+     * @brief Installe une topologie existante et remet la coloration à zéro (aucun noeud colorié).
+     * @param table La topologie.
+     */
+    void setTopology(std::shared_ptr<const Topology> table);
+
     int numNodes; // Le nombre de noeuds dans le graphe.
-    std::vector<Node> nodes; // Le vecteur de noeuds du graphe.
+    std::vector<Color> colors; // La couleur de chaque noeud plus un (0 : pas de couleur).
     std::vector<int> conflictCount; // Le vecteur qui compte les conflits du graphe.
+    std::vector<int> conflictingNodes; // Les noeuds en conflit (ordre quelconque, retrait par échange avec le dernier).
+    std::vector<int> conflictingPos; // Position de chaque noeud dans conflictingNodes, -1 s'il n'est pas en conflit.
+    int totalConflicts = 0; // La somme de conflictCount (deux fois le nombre de conflits).
+    std::shared_ptr<const Topology> topology; // La topologie partagée (lecture seule).
+    const int* offsetsData = nullptr; // Accès direct à topology->offsets.
+    const int* neighborsData = nullptr; // Accès direct à topology->neighbors.
+    const std::uint64_t* bitsData = nullptr; // Accès direct à topology->bits, nul si le graphe est creux.
+    int words = 0; // Nombre de mots de 64 bits par ligne de la matrice et par classe de couleur.
+    std::vector<std::uint64_t> colorClasses; // Ensemble de bits des noeuds de chaque couleur (représentation dense).
 };
 
 #endif
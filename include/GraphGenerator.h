@@ -0,0 +1,85 @@
+/**
+ * @file GraphGenerator.h
+ * @brief Définit les générateurs de graphes synthétiques (graphes aléatoires G(n, p) de type DSJC, graphes de type
+ * Leighton et graphes plats à k-coloration cachée) utilisés pour les études de passage à l'échelle.
+ */
+
+#ifndef GRAPHGENERATOR_H
+#define GRAPHGENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct GeneratedGraph
+ * @brief Graphe produit par un générateur : liste d'arêtes sans doublon ni boucle et coloration cachée.
+ */
+struct GeneratedGraph {
+    int numNodes = 0; // Le nombre de noeuds.
+    std::vector<std::pair<int, int>> edges; // Les arêtes (u, v), u != v, chacune une seule fois.
+    std::vector<int> planted; // La k-coloration légale cachée dans le graphe, vide pour G(n, p).
+};
+
+/**
+ * @brief Graphe aléatoire G(n, p) (famille DSJC) : chaque paire de noeuds est reliée avec la probabilité p.
+ *
+ * Les paires sont parcourues par sauts géométriques (Batagelj et Brandes) : le coût est en O(n + m) et non en O(n²),
+ * ce qui permet de produire des graphes creux de plusieurs millions de noeuds.
+ *
+ * @param numNodes Le nombre de noeuds.
+ * @param p La probabilité d'une arête, dans [0, 1].
+ * @param seed La graine : une même graine produit le même graphe sur toutes les plateformes.
+ * @return Le graphe.
+ * @throw std::invalid_argument si les paramètres sont hors de leur domaine ou si le graphe dépasse 2^30 arêtes.
+ */
+GeneratedGraph generateRandomGraph(int numNodes, double p, std::uint64_t seed);
+
+/**
+ * @brief Graphe de type Leighton : les noeuds sont répartis en k classes de même taille et les arêtes proviennent de
+ * cliques dont chaque noeud est pris dans une classe différente.
+ *
+ * Une première clique de taille k rend le nombre chromatique égal à k, puis des cliques de taille tirée dans [2, k]
+ * sont ajoutées jusqu'à atteindre p * (nombre de paires de noeuds de classes différentes) arêtes. La répartition en
+ * classes est une k-coloration légale.
+ *
+ * @param numNodes Le nombre de noeuds, au moins k.
+ * @param k Le nombre de classes, au moins 2.
+ * @param p La densité des arêtes entre classes différentes, dans [0, 0.5].
+ * @param seed La graine : une même graine produit le même graphe sur toutes les plateformes.
+ * @return Le graphe et sa coloration cachée.
+ * @throw std::invalid_argument si les paramètres sont hors de leur domaine ou si le graphe dépasse 2^30 arêtes.
+ */
+GeneratedGraph generateLeightonGraph(int numNodes, int k, double p, std::uint64_t seed);
+
+/**
+ * @brief Graphe plat (famille flat de Culberson) : les noeuds sont répartis en k classes de même taille, chaque paire
+ * de classes reçoit le même nombre d'arêtes et les degrés d'un noeud vers chaque autre classe diffèrent d'au plus un.
+ *
+ * Entre deux classes, les arêtes forment une bande circulante (les noeuds d'une classe sont reliés à des blocs
+ * consécutifs de l'autre, parcourue avec un décalage et un pas aléatoires) : aucun noeud ne se distingue par son degré,
+ * ce qui prive les heuristiques gloutonnes de leur principal indice.
+ *
+ * @param numNodes Le nombre de noeuds, au moins k.
+ * @param k Le nombre de classes, au moins 2.
+ * @param p La densité des arêtes entre classes différentes, dans [0, 1].
+ * @param seed La graine : une même graine produit le même graphe sur toutes les plateformes.
+ * @return Le graphe et sa coloration cachée.
+ * @throw std::invalid_argument si les paramètres sont hors de leur domaine ou si le graphe dépasse 2^30 arêtes.
+ */
+GeneratedGraph generateFlatGraph(int numNodes, int k, double p, std::uint64_t seed);
+
+/**
+ * @brief Génère un graphe de la famille donnée.
+ * @param type La famille : "gnp", "leighton" ou "flat".
+ * @param numNodes Le nombre de noeuds.
+ * @param k Le nombre de classes (ignoré pour "gnp").
+ * @param p La densité (probabilité d'une arête pour "gnp", densité entre classes sinon).
+ * @param seed La graine.
+ * @return Le graphe.
+ * @throw std::invalid_argument si la famille est inconnue ou si les paramètres sont hors de leur domaine.
+ */
+GeneratedGraph generateGraph(const std::string& type, int numNodes, int k, double p, std::uint64_t seed);
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file GraphLoader.h
+ * @brief Définit les fonctions de chargement d'un graphe : lecture d'un fichier DIMACS projeté en mémoire et
+ * cache binaire de la table d'adjacence CSR.
+ */
+
+#ifndef GRAPHLOADER_H
+#define GRAPHLOADER_H
+
+#include "Graph.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lit un graphe à partir d'un fichier au format DIMACS et crée un objet Graph correspondant.
+ *
+ * Le fichier est projeté en mémoire puis analysé avec un lecteur d'entiers écrit à la main. Les lignes `c`, `p` et
+ * `e` peuvent apparaître dans n'importe quel ordre. Si useCache vaut true, un cache binaire (en-tête et tableaux CSR)
+ * situé à côté du fichier source est utilisé s'il est à jour, et créé sinon. Un fichier dont le nom se termine par
+ * `.csr` est lu directement comme un cache binaire (graphes produits par le générateur sans fichier DIMACS).
+ *
+ * @param filename Le nom du fichier contenant les données du graphe au format DIMACS, ou un cache binaire `.csr`.
+ * @param useCache true pour lire et écrire le cache binaire.
+ * @return Un objet Graph représentant le graphe extrait du fichier.
+ * @throw std::invalid_argument si le fichier ne peut pas être ouvert ou s'il y a des erreurs dans le format du fichier.
+ */
+Graph readGraphFromFile(const std::string& filename, bool useCache = false);
+
+/**
+ * @brief Lit un graphe au format DIMACS sans utiliser de cache.
+ * @param filename Le nom du fichier contenant les données du graphe au format DIMACS.
+ * @return Un objet Graph représentant le graphe extrait du fichier.
+ * @throw std::invalid_argument si le fichier ne peut pas être ouvert ou s'il y a des erreurs dans le format du fichier.
+ */
+Graph readDimacsFile(const std::string& filename);
+
+/**
+ * @brief Obtient le nom du cache binaire associé à un fichier DIMACS.
+ * @param filename Le nom du fichier DIMACS.
+ * @return Le nom du fichier de cache.
+ */
+std::string graphCachePath(const std::string& filename);
+
+/**
+ * @brief Obtient la taille et la date de modification d'un fichier source (l'empreinte qui invalide le cache binaire).
+ * @param sourceFile Le nom du fichier.
+ * @param size La taille du fichier, non modifiée en cas d'échec.
+ * @param time La date de modification du fichier, non modifiée en cas d'échec.
+ * @return false si le fichier n'existe pas.
+ */
+bool sourceStamp(const std::string& sourceFile, std::int64_t& size, std::int64_t& time);
+
+/**
+ * @brief Écrit la table d'adjacence CSR d'un graphe dans un cache binaire.
+ *
+ * Le fichier est d'abord écrit sous un nom temporaire puis renommé, un cache partiellement écrit n'est donc jamais
+ * lu. La taille et la date de modification du fichier source sont enregistrées pour invalider le cache.
+ *
+ * @param graph Le graphe à écrire.
+ * @param cacheFile Le nom du fichier de cache.
+ * @param sourceFile Le nom du fichier DIMACS source, vide si le graphe n'a pas de fichier source.
+ * @return true si le cache a été écrit.
+ */
+bool writeGraphCache(const Graph& graph, const std::string& cacheFile, const std::string& sourceFile = "");
+
+/**
+ * @brief Lit un graphe depuis un cache binaire.
+ * @param cacheFile Le nom du fichier de cache.
+ * @param sourceFile Le nom du fichier DIMACS source, vide pour ne pas vérifier que le cache est à jour.
+ * @param graph Le graphe lu, non modifié en cas d'échec.
+ * @return true si le cache existe, est valide et est à jour.
+ */
+bool readGraphCache(const std::string& cacheFile, const std::string& sourceFile, Graph& graph);
+
+/**
+ * @brief Écrit un graphe au format DIMACS (`p edge`, puis une ligne `e u v` par arête, noeuds numérotés à partir de 1).
+ * @param filename Le nom du fichier à écrire.
+ * @param numNodes Le nombre de noeuds.
+ * @param edges Les arêtes (u, v), ID dans [0, numNodes-1].
+ * @param comment Le commentaire écrit en tête du fichier (ligne `c`), aucun s'il est vide.
+ * @throw std::runtime_error si le fichier ne peut pas être écrit.
+ */
+void writeDimacsFile(const std::string& filename, int numNodes, const std::vector<std::pair<int, int>>& edges,
+                     const std::string& comment = "");
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * @file GraphOrdering.h
+ * @brief Définit la renumérotation des noeuds d'un graphe pour la localité mémoire (Cuthill-McKee inverse, degrés
+ * décroissants ou parcours en largeur) et le retour d'une coloration vers la numérotation d'origine.
+ */
+
+#ifndef GRAPHORDERING_H
+#define GRAPHORDERING_H
+
+#include "Graph.h"
+#include <string>
+#include <vector>
+
+/**
+ * @struct Reordering
+ * @brief Résultat de la renumérotation : graphe renuméroté et permutation des noeuds.
+ */
+struct Reordering {
+    Graph graph; // Le graphe renuméroté, les voisins de chaque noeud sont triés par ID croissant.
+    std::vector<int> newToOriginal; // newToOriginal[i] : l'ID dans le graphe d'origine du noeud i.
+};
+
+/**
+ * @struct AdjacencyLocality
+ * @brief Mesure de la localité de la table d'adjacence : écart entre l'ID d'un noeud et ceux de ses voisins. Plus
+ * l'écart est faible, plus les couleurs et les compteurs des voisins lus par les algorithmes sont proches en mémoire.
+ */
+struct AdjacencyLocality {
+    int bandwidth = 0; // La largeur de bande : le plus grand écart |u - v| sur une arête.
+    double meanGap = 0; // L'écart |u - v| moyen sur les arêtes.
+};
+
+/**
+ * @return Les noms des renumérotations disponibles : "rcm", "degree" et "bfs".
+ */
+const std::vector<std::string>& orderingNames();
+
+/**
+ * @brief Calcule l'ordre des noeuds d'une renumérotation.
+ *
+ * - "rcm" : Cuthill-McKee inverse. Chaque composante est parcourue en largeur depuis un noeud pseudo-périphérique
+ *   (heuristique de George et Liu), les voisins étant visités par degré croissant, puis l'ordre est inversé. La
+ *   largeur de bande est faible : les voisins d'un noeud ont des ID proches.
+ * - "degree" : degrés décroissants. Les noeuds les plus souvent lus (ceux de plus haut degré) sont regroupés.
+ * - "bfs" : parcours en largeur de chaque composante depuis son plus petit ID, dans l'ordre de la table d'adjacence.
+ *
+ * Le coût est en O(n log n + m), plus quelques parcours par composante pour "rcm".
+ *
+ * @param graph Le graphe.
+ * @param method Le nom de la renumérotation (voir orderingNames).
+ * @return order[i] : l'ID dans le graphe du noeud qui reçoit le numéro i.
+ * @throw std::invalid_argument si la renumérotation est inconnue.
+ */
+std::vector<int> vertexOrdering(const Graph& graph, const std::string& method);
+
+/**
+ * @brief Renumérote les noeuds du graphe et reconstruit sa table d'adjacence (et sa matrice de bits s'il est dense).
+ * La coloration du graphe n'est pas reprise.
+ * @param graph Le graphe d'origine.
+ * @param method Le nom de la renumérotation (voir orderingNames).
+ * @return Le graphe renuméroté et la permutation.
+ * @throw std::invalid_argument si la renumérotation est inconnue.
+ */
+Reordering reorderGraph(const Graph& graph, const std::string& method);
+
+/**
+ * @brief Ramène une coloration du graphe renuméroté vers la numérotation d'origine.
+ * @param reordering La renumérotation obtenue avec reorderGraph.
+ * @param coloring La coloration du graphe renuméroté.
+ * @return La coloration indexée par les ID d'origine.
+ * @throw std::invalid_argument si coloring ne correspond pas au graphe renuméroté.
+ */
+std::vector<int> restoreOriginalColoring(const Reordering& reordering, const std::vector<int>& coloring);
+
+/**
+ * @brief Mesure la localité de la table d'adjacence d'un graphe.
+ * @param graph Le graphe.
+ * @return La largeur de bande et l'écart moyen entre voisins.
+ */
+AdjacencyLocality adjacencyLocality(const Graph& graph);
+
+#endif
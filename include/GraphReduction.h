@@ -0,0 +1,51 @@
+/**
+ * @file GraphReduction.h
+ * @brief Définit la réduction d'un graphe par retrait itératif des noeuds de degré inférieur à k, et la réinsertion
+ * de ces noeuds dans une coloration du noyau.
+ */
+
+#ifndef GRAPHREDUCTION_H
+#define GRAPHREDUCTION_H
+
+#include "Graph.h"
+#include <vector>
+
+/**
+ * @struct Reduction
+ * @brief Résultat de la réduction : noyau du graphe et noeuds retirés.
+ */
+struct Reduction {
+    Graph core; // Le noyau : sous-graphe induit par les noeuds restants.
+    std::vector<int> coreToOriginal; // coreToOriginal[i] : l'ID dans le graphe complet du noeud i du noyau.
+    std::vector<int> removed; // Les noeuds retirés (ID du graphe complet), dans l'ordre du retrait.
+};
+
+/**
+ * @brief Retire itérativement les noeuds de degré inférieur à k.
+ *
+ * Un noeud qui a moins de k voisins peut toujours recevoir une couleur libre une fois ses voisins coloriés : il est
+ * retiré, ce qui diminue le degré de ses voisins, et ainsi de suite jusqu'à ce que tous les noeuds restants aient au
+ * moins k voisins dans le noyau. Le coût est en O(n + m).
+ *
+ * @param graph Le graphe complet.
+ * @param k Le nombre de couleur utilisable.
+ * @return Le noyau et les noeuds retirés.
+ */
+Reduction peelLowDegree(const Graph& graph, int k);
+
+/**
+ * @brief Colorie le graphe complet à partir d'une coloration du noyau.
+ *
+ * Les noeuds du noyau reprennent leur couleur, puis les noeuds retirés sont coloriés dans l'ordre inverse du retrait :
+ * au moment de sa réinsertion, un noeud a moins de k voisins déjà coloriés et reçoit la première couleur absente de
+ * son voisinage. Les conflits du graphe complet sont donc exactement ceux du noyau.
+ *
+ * @param graph Le graphe complet, colorié par la fonction.
+ * @param reduction La réduction obtenue avec peelLowDegree.
+ * @param coreColoring La coloration du noyau.
+ * @param k Le nombre de couleur utilisable.
+ * @throw std::invalid_argument si coreColoring ne correspond pas au noyau.
+ */
+void reinsertPeeled(Graph& graph, const Reduction& reduction, const std::vector<int>& coreColoring, int k);
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file HybridEvolution.h
+ * @brief Définit la classe HybridEvolution, un algorithme évolutionnaire hybride (croisement GPX et amélioration des
+ * enfants par recherche tabou) dont les enfants sont évalués en parallèle.
+ */
+
+#ifndef HYBRIDEVOLUTION_H
+#define HYBRIDEVOLUTION_H
+
+#include "Graph.h"
+#include "TabuCol.h"
+#include "SearchStats.h"
+#include <vector>
+#include <random>
+#include <memory>
+
+/**
+ * @class HybridEvolution
+ * @brief Algorithme évolutionnaire hybride (Galinier & Hao) pour la k-coloration.
+ *
+ * La population est stockée dans un tableau unique de populationSize x n couleurs, alloué une fois pour toutes :
+ * aucun graphe n'est copié par individu. À chaque génération, chaque thread tire deux parents, construit un enfant
+ * par croisement GPX (les classes de couleur les plus grandes sont héritées alternativement de chaque parent) puis
+ * l'améliore avec TabuCol. Les enfants remplacent ensuite le pire individu de la population s'ils ne sont pas moins
+ * bons que lui. Les threads sont créés une fois par appel à run et synchronisés par une barrière à la fin de chaque
+ * génération ; les tampons du croisement sont alloués par le constructeur.
+ */
+class HybridEvolution {
+public:
+    /**
+     * @brief Constructeur de la classe HybridEvolution.
+     * @param graph Le graphe à colorier, sa coloration courante (si elle utilise les couleurs [0, k-1]) sert de
+     * premier individu.
+     * @param k Le nombre de couleur utilisable.
+     * @param populationSize Le nombre d'individus.
+     * @param numThreads Le nombre de threads (et d'enfants par génération).
+     * @param seed La graine du générateur aléatoire.
+     * @throw std::invalid_argument si populationSize < 2, si numThreads < 1 ou si k < 2.
+     */
+    HybridEvolution(const Graph& graph, int k, int populationSize, int numThreads, unsigned seed);
+
+    /**
+     * @brief Lance l'algorithme évolutionnaire.
+     * @param childIter Le nombre d'itérations de la recherche tabou appliquée à chaque enfant.
+     * @param maxGenerations Le nombre maximum de générations.
+     * @param budget Le budget de l'algorithme (temps, coût cible, annulation), partagé par les recherches tabou.
+     * @return Le nombre de conflits de la meilleure coloration rencontrée, y compris si l'algorithme est interrompu.
+     */
+    int run(long long childIter, long long maxGenerations, RunBudget budget);
+
+    /**
+     * @return La meilleure coloration rencontrée.
+     */
+    [[nodiscard]] const std::vector<int>& getBestColoring() const;
+
+    /**
+     * @return Le temps (en secondes) écoulé avant de trouver la meilleure coloration.
+     */
+    [[nodiscard]] double getTimeToBest() const;
+
+    /**
+     * @return Le nombre de générations effectuées lors du dernier appel à run.
+     */
+    [[nodiscard]] long long getGenerations() const;
+
+    /**
+     * @return Les mesures du dernier appel à run.
+     */
+    [[nodiscard]] const SearchStats& getStats() const;
+
+private:
+    /**
+     * @struct Worker
+     * @brief État d'un thread : solution de travail, recherche tabou et tampons du croisement.
+     */
+    struct Worker {
+        Graph solution; // La solution de travail de la recherche tabou (topologie partagée).
+        std::unique_ptr<TabuCol> tabu; // La recherche tabou appliquée aux enfants.
+        std::mt19937 rng; // Le générateur aléatoire du thread.
+        std::vector<int> child; // L'enfant courant.
+        int childCost = 0; // Le nombre de conflits de l'enfant après amélioration.
+        SearchStats stats; // Les compteurs cumulés des recherches tabou du thread.
+        std::vector<int> members; // Les noeuds de chaque parent triés par couleur (2 x n).
+        std::vector<int> classStart; // Le début de chaque classe dans members (2 x (k + 1)).
+        std::vector<int> classSize; // Le nombre de noeuds non attribués de chaque classe (2 x k).
+        std::vector<int> next; // La prochaine position libre de chaque classe pendant le tri des noeuds (k).
+    };
+
+    /**
+     * @brief Construit un enfant par croisement GPX (greedy partition crossover).
+     * @param parentA La coloration du premier parent.
+     * @param parentB La coloration du second parent.
+     * @param worker Le thread, l'enfant est écrit dans worker.child.
+     */
+    void crossover(const int* parentA, const int* parentB, Worker& worker) const;
+
+    /**
+     * @brief Améliore worker.child par recherche tabou.
+     * @param worker Le thread.
+     * @param budget Le budget de la recherche tabou.
+     */
+    static void improve(Worker& worker, const RunBudget& budget);
+
+    int k; // Le nombre de couleur utilisable.
+    int numNodes; // Le nombre de noeuds du graphe.
+    int populationSize; // Le nombre d'individus.
+    std::vector<int> pool; // La population : populationSize x numNodes couleurs.
+    std::vector<int> poolCost; // Le nombre de conflits de chaque individu.
+    std::vector<std::unique_ptr<Worker>> workers; // Les threads.
+    std::mt19937 rng; // Le générateur aléatoire de la sélection.
+    std::vector<int> bestColoring; // La meilleure coloration rencontrée.
+    double timeToBest = 0; // Le temps (en secondes) avant la meilleure coloration.
+    long long generations = 0; // Le nombre de générations effectuées.
+    SearchStats stats; // Les mesures du dernier appel à run.
+};
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file KempeChain.h
+ * @brief Définit la classe KempeChain, le calcul d'une chaîne de Kempe par parcours en largeur sur deux classes de
+ * couleur et l'évaluation incrémentale de l'échange de ses couleurs.
+ */
+
+#ifndef KEMPECHAIN_H
+#define KEMPECHAIN_H
+
+#include "Graph.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class KempeChain
+ * @brief Chaîne de Kempe K(v, a, b) : composante connexe de v dans le sous-graphe des arêtes entre un noeud de
+ * couleur a et un noeud de couleur b, où a est la couleur de v. L'échange des couleurs a et b sur la chaîne ne crée
+ * aucun conflit et supprime les conflits entre la chaîne et le reste du graphe.
+ *
+ * Les arêtes en conflit (deux noeuds de même couleur) ne sont pas suivies : sur une coloration légale, la chaîne est
+ * la chaîne de Kempe habituelle. Les tampons (file du parcours et marques de visite) sont alloués une fois : les
+ * marques portent un numéro de génération incrémenté à chaque chaîne, aucun mouvement n'alloue de mémoire.
+ */
+class KempeChain {
+public:
+    /**
+     * @brief Constructeur de la classe KempeChain.
+     * @param numNodes Le nombre de noeuds du graphe.
+     * @param firstGeneration La génération des marques avant la première chaîne (proche de UINT32_MAX, elle permet
+     * de vérifier le débordement du compteur).
+     */
+    explicit KempeChain(int numNodes, std::uint32_t firstGeneration = 0);
+
+    /**
+     * @brief Calcule la chaîne de Kempe d'un noeud vers une autre couleur et la variation du nombre de conflits de
+     * l'échange, sans modifier le graphe. La variation ne parcourt que les voisins des noeuds de la chaîne.
+     * @param graph Le graphe colorié.
+     * @param v L'ID du noeud de départ.
+     * @param otherColor La seconde couleur de la chaîne, différente de celle de v.
+     * @return La variation du nombre de conflits si les couleurs de la chaîne sont échangées.
+     */
+    int build(const Graph& graph, int v, int otherColor);
+
+    /**
+     * @brief Échange les deux couleurs sur les noeuds de la dernière chaîne calculée par build.
+     * @param graph Le graphe, dont la coloration n'a pas changé depuis build.
+     */
+    void apply(Graph& graph) const;
+
+    /**
+     * @return Les noeuds de la dernière chaîne calculée par build.
+     */
+    [[nodiscard]] const std::vector<int>& getNodes() const;
+
+private:
+    std::vector<std::uint32_t> mark; // La génération à laquelle chaque noeud a été ajouté à la chaîne.
+    std::uint32_t generation = 0; // La génération de la chaîne courante.
+    std::vector<int> nodes; // Les noeuds de la chaîne, dans l'ordre du parcours (sert aussi de file).
+    int colorA = 0; // La couleur du noeud de départ.
+    int colorB = 0; // La seconde couleur de la chaîne.
+};
+
+#endif
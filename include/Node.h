@@ -6,7 +6,6 @@
 #ifndef NODE_H
 #define NODE_H
 
-#include <list>
 #include <stdexcept> // Pour les exceptions
 
 class Graph;  // Avant-déclaration de la classe Graph
@@ -43,25 +42,14 @@ public:
     void setColor(int c);
 
     /**
-     * @brief Obtient la liste des ID des noeuds voisins.
-     * @return Une référence constante vers la liste des ID des noeuds voisins.
-     */
-    [[nodiscard]] const std::list<int>& getNeighbors() const;
-
-    /**
-     * @brief Ajoute un noeud voisin.
-     * @param neighborID L'ID du noeud voisin à ajouter.
-     */
-    void addNeighbor(int neighborID);
-
-    /**
-     * @brief Crée une copie en profondeur du noeud.
-     * @return Une nouvelle instance de Node copiée en profondeur.
+     * @brief Crée une copie du noeud.
+     * @return Une nouvelle instance de Node avec le même ID et la même couleur.
      */
     [[nodiscard]] Node clone();
 
     /**
      * @brief Compte les conflits avec les noeuds voisins.
+     * Les voisins sont lus dans la table d'adjacence du graphe.
      * @param g Le graphe sur lequel on travail
      * @return Le nombre de conflit.
      */
@@ -77,7 +65,6 @@ public:
 private:
     int id; // L'ID du noeud.
     int color; // La couleur du noeud, -1 signifie que la couleur n'a pas été attribuée.
-    std::list<int> neighbors; // La liste des ID des noeuds voisins.
 };
 
 #endif
@@ -0,0 +1,128 @@
+/**
+ * @file ParallelTempering.h
+ * @brief Définit la classe ParallelTempering, un recuit à échange de répliques (parallel tempering) où chaque
+ * réplique est exécutée dans son propre thread.
+ */
+
+#ifndef PARALLELTEMPERING_H
+#define PARALLELTEMPERING_H
+
+#include "Graph.h"
+#include "SearchStats.h"
+#include "Annealing.h"
+#include "RunBudget.h"
+#include <vector>
+#include <random>
+#include <atomic>
+
+/**
+ * @class ParallelTempering
+ * @brief Échange de répliques sur une échelle de températures géométrique.
+ *
+ * Chaque réplique est une coloration complète explorée à température fixe avec le mouvement de recolorAllNodes
+ * (un noeud tiré au hasard reçoit une autre couleur), évalué par la variation du nombre de conflits et accepté selon
+ * la table de seuils de la réplique (AcceptanceTable), recalculée lorsque sa température change. Après chaque
+ * tour de exchangeInterval mouvements, les répliques voisines sur l'échelle échangent leurs températures selon le
+ * critère de Metropolis : min(1, exp((1/Ti - 1/Tj) * (Ei - Ej))). Les tours alternent entre les paires paires et
+ * impaires de l'échelle.
+ */
+class ParallelTempering {
+public:
+    /**
+     * @brief Constructeur de la classe ParallelTempering.
+     * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale à chaque réplique.
+     * @param k Le nombre de couleur utilisable.
+     * @param numReplicas Le nombre de répliques (et de threads).
+     * @param minTemp La température la plus basse de l'échelle.
+     * @param maxTemp La température la plus haute de l'échelle.
+     * @param seed La graine du générateur aléatoire.
+     * @throw std::invalid_argument si numReplicas < 2, si les températures sont invalides ou si k < 2.
+     */
+    ParallelTempering(const Graph& graph, int k, int numReplicas, double minTemp, double maxTemp, unsigned seed);
+
+    /**
+     * @brief Lance l'échange de répliques.
+     * @param exchangeInterval Le nombre de mouvements de chaque réplique entre deux tentatives d'échange.
+     * @param maxRounds Le nombre maximum de tours.
+     * @param budget Le budget de l'échange (temps, coût cible, annulation), vérifié à la fin de chaque tour.
+     * @return Le nombre de conflits de la meilleure coloration rencontrée, y compris si l'échange est interrompu.
+     */
+    int run(int exchangeInterval, long long maxRounds, RunBudget budget);
+
+    /**
+     * @return La meilleure coloration rencontrée.
+     */
+    [[nodiscard]] const std::vector<int>& getBestColoring() const;
+
+    /**
+     * @return Le temps (en secondes) écoulé avant de trouver la meilleure coloration.
+     */
+    [[nodiscard]] double getTimeToBest() const;
+
+    /**
+     * @return Le nombre total de mouvements évalués par toutes les répliques.
+     */
+    [[nodiscard]] long long getMoves() const;
+
+    /**
+     * @return Le nombre d'échanges tentés.
+     */
+    [[nodiscard]] long long getSwapAttempts() const;
+
+    /**
+     * @return Le nombre d'échanges acceptés.
+     */
+    [[nodiscard]] long long getSwapAccepted() const;
+
+    /**
+     * @return Les mesures du dernier appel à run (répliques fusionnées).
+     */
+    [[nodiscard]] const SearchStats& getStats() const;
+
+private:
+    /**
+     * @struct Replica
+     * @brief État d'une réplique : coloration, générateur et meilleure solution rencontrée.
+     */
+    struct Replica {
+        Graph solution; // La coloration courante (topologie partagée).
+        RandomStream<Xoshiro256> stream{0}; // Le flux aléatoire de la réplique.
+        int cost = 0; // Le nombre de conflits de la coloration courante.
+        double temperature = 0; // La température courante de la réplique.
+        AcceptanceTable acceptance; // Les seuils d'acceptation à la température courante.
+        std::vector<int> bestColoring; // La meilleure coloration de la réplique.
+        int bestCost = 0; // Le nombre de conflits de bestColoring.
+        double bestTime = 0; // Le temps (en secondes) de bestColoring.
+        long long moves = 0; // Le nombre de mouvements évalués.
+        SearchStats stats; // Les mesures de la réplique.
+    };
+
+    /**
+     * @brief Effectue numMoves mouvements de Metropolis sur une réplique à sa température courante.
+     * @param replica La réplique.
+     * @param numMoves Le nombre de mouvements.
+     * @param elapsed Le temps écoulé depuis le début au début du tour.
+     */
+    void sweep(Replica& replica, int numMoves, double elapsed);
+
+    /**
+     * @brief Tente les échanges de températures entre répliques voisines sur l'échelle.
+     * @param round Le numéro du tour (détermine la parité des paires).
+     */
+    void exchange(long long round);
+
+    int k; // Le nombre de couleur utilisable.
+    std::vector<Replica> replicas; // Les répliques.
+    std::vector<double> ladder; // Les températures de l'échelle, par ordre croissant.
+    std::vector<int> replicaAt; // replicaAt[p] : l'indice de la réplique à la position p de l'échelle.
+    std::mt19937 exchangeRng; // Le générateur aléatoire des échanges.
+    std::atomic<bool> solved; // Vaut true dès qu'une réplique atteint le coût cible.
+    int targetCost = 0; // Le coût cible du dernier appel à run.
+    std::vector<int> bestColoring; // La meilleure coloration rencontrée.
+    double timeToBest = 0; // Le temps (en secondes) avant la meilleure coloration.
+    long long swapAttempts = 0; // Le nombre d'échanges tentés.
+    long long swapAccepted = 0; // Le nombre d'échanges acceptés.
+    SearchStats stats; // Les mesures du dernier appel à run.
+};
+
+#endif
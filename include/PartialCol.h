@@ -0,0 +1,107 @@
+/**
+ * @file PartialCol.h
+ * @brief Définit la classe PartialCol, une recherche tabou sur les k-colorations partielles légales avec un ensemble
+ * de noeuds non coloriés.
+ */
+
+#ifndef PARTIALCOL_H
+#define PARTIALCOL_H
+
+#include "Graph.h"
+#include "SearchStats.h"
+#include "RunBudget.h"
+#include <vector>
+#include <random>
+
+/**
+ * @class PartialCol
+ * @brief Recherche tabou PartialCol (Blöchliger & Zufferey) sur les k-colorations partielles légales.
+ *
+ * La solution est une coloration sans conflit d'une partie des noeuds, les autres forment l'ensemble des noeuds non
+ * coloriés, dont la taille est le coût à minimiser. Un mouvement (v, c) colorie un noeud non colorié v avec la couleur
+ * c et retire la couleur de ses voisins de couleur c, qui rejoignent l'ensemble des noeuds non coloriés : la solution
+ * reste légale. La table adjacentColors[v * k + c] contient le nombre de voisins coloriés de v ayant la couleur c,
+ * le mouvement (v, c) change donc le coût de adjacentColors[v * k + c] - 1, évalué en O(1). Remettre un noeud
+ * retiré dans sa couleur précédente est tabou pendant une durée dynamique et réactive, comme dans TabuCol.
+ */
+class PartialCol {
+public:
+    static constexpr int UNCOLORED = -1; // La couleur d'un noeud non colorié.
+
+    /**
+     * @brief Constructeur de la classe PartialCol.
+     * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale.
+     * @param k Le nombre de couleur utilisable.
+     * @param seed La graine du générateur aléatoire.
+     * @throw std::invalid_argument si k est inférieur à 1 ou si un noeud a une couleur hors de [0, k-1].
+     */
+    PartialCol(Graph& graph, int k, unsigned seed);
+
+    /**
+     * @brief Remplace la solution initiale sans réallouer les tables. Les noeuds en conflit sont retirés un à un
+     * (dans l'ordre des ID) jusqu'à obtenir une coloration partielle légale.
+     * @param coloring La nouvelle solution initiale, une couleur par noeud.
+     * @throw std::invalid_argument si la taille ne correspond pas au graphe ou si une couleur est hors de [0, k-1].
+     */
+    void reset(const std::vector<int>& coloring);
+
+    /**
+     * @brief Lance la recherche tabou puis applique au graphe la meilleure coloration partielle rencontrée, y compris
+     * si la recherche est interrompue : chaque noeud non colorié reçoit la couleur qui provoque le moins de conflits.
+     * @param budget Le budget de la recherche (temps, itérations, annulation), le coût cible porte sur le nombre de
+     * noeuds non coloriés.
+     * @return Le nombre de conflits de la coloration appliquée au graphe.
+     */
+    int run(RunBudget budget);
+
+    /**
+     * @return Le nombre d'itérations effectuées lors du dernier appel à run.
+     */
+    [[nodiscard]] long long getIterations() const;
+
+    /**
+     * @return Le nombre de noeuds non coloriés de la meilleure coloration partielle du dernier appel à run.
+     */
+    [[nodiscard]] int getBestUncolored() const;
+
+    /**
+     * @return La meilleure coloration partielle du dernier appel à run, avant sa complétion (UNCOLORED pour les
+     * noeuds non coloriés).
+     */
+    [[nodiscard]] const std::vector<int>& getBestPartialColoring() const;
+
+    /**
+     * @return Les mesures du dernier appel à run, dont le coût est le nombre de noeuds non coloriés.
+     */
+    [[nodiscard]] const SearchStats& getStats() const;
+
+private:
+    /**
+     * @brief Colorie un noeud non colorié et met à jour la table des couleurs adjacentes.
+     * @param v L'ID du noeud.
+     * @param color La couleur.
+     */
+    void colorNode(int v, int color);
+
+    /**
+     * @brief Retire la couleur d'un noeud, qui rejoint l'ensemble des noeuds non coloriés.
+     * @param v L'ID du noeud.
+     */
+    void uncolorNode(int v);
+
+    Graph& graph; // Le graphe à colorier.
+    int k; // Le nombre de couleur utilisable.
+    int numNodes; // Le nombre de noeuds du graphe.
+    std::mt19937 rng; // Le générateur aléatoire.
+    std::vector<int> colors; // La couleur courante de chaque noeud, UNCOLORED s'il n'est pas colorié.
+    std::vector<int> adjacentColors; // Table n x k : nombre de voisins coloriés de v ayant la couleur c.
+    std::vector<long long> tabuUntil; // Table n x k : itération jusqu'à laquelle le mouvement (v, c) est tabou.
+    std::vector<int> uncolored; // Les noeuds non coloriés (ordre quelconque).
+    std::vector<int> uncoloredPos; // Position de chaque noeud dans uncolored, -1 s'il est colorié.
+    std::vector<int> bestColors; // La meilleure coloration partielle du dernier appel à run.
+    int bestUncolored; // Le nombre de noeuds non coloriés de la meilleure solution du dernier appel à run.
+    long long iterations; // Le nombre d'itérations effectuées.
+    SearchStats stats; // Les mesures du dernier appel à run.
+};
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * @file RoundBarrier.h
+ * @brief Définit la classe RoundBarrier, une barrière réutilisable qui synchronise des threads à la fin de chaque tour
+ * (échange de répliques, génération de l'algorithme évolutionnaire).
+ */
+
+#ifndef ROUNDBARRIER_H
+#define ROUNDBARRIER_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+/**
+ * @class RoundBarrier
+ * @brief Barrière réutilisable : le dernier thread arrivé exécute l'action de fin de tour avant de libérer les autres.
+ *
+ * L'action est exécutée sous le verrou de la barrière : les variables qu'elle modifie sont visibles de tous les
+ * threads à leur sortie de arriveAndWait.
+ */
+class RoundBarrier {
+public:
+    /**
+     * @brief Constructeur de la classe RoundBarrier.
+     * @param count Le nombre de threads attendus à chaque tour.
+     */
+    explicit RoundBarrier(int count);
+
+    /**
+     * @brief Attend que tous les threads soient arrivés.
+     * @param completion L'action exécutée une seule fois par le dernier thread arrivé.
+     */
+    void arriveAndWait(const std::function<void()>& completion);
+
+private:
+    std::mutex mutex; // Protège les compteurs.
+    std::condition_variable condition; // Signalé à la fin de chaque tour.
+    int count; // Le nombre de threads attendus.
+    int waiting; // Le nombre de threads arrivés au tour courant.
+    long long generation; // Le numéro du tour courant.
+};
+
+#endif
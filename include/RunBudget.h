@@ -0,0 +1,177 @@
+/**
+ * @file RunBudget.h
+ * @brief Définit le budget d'une recherche (temps, itérations, coût cible), le jeton d'annulation partagé entre les
+ * algorithmes et l'interruption par SIGINT/SIGTERM.
+ */
+
+#ifndef RUNBUDGET_H
+#define RUNBUDGET_H
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+/**
+ * @class CancellationToken
+ * @brief Jeton d'annulation interrogé par les algorithmes, éventuellement rattaché à un jeton parent : il est annulé
+ * dès que lui-même ou l'un de ses ancêtres l'est.
+ */
+class CancellationToken {
+public:
+    /**
+     * @brief Constructeur de la classe CancellationToken.
+     * @param parent Le jeton parent, nul si le jeton est indépendant.
+     */
+    explicit CancellationToken(const CancellationToken* parent = nullptr) : parent(parent) {}
+
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken& operator=(const CancellationToken&) = delete;
+
+    /**
+     * @brief Annule le jeton (et ses descendants). Peut être appelé depuis un gestionnaire de signal.
+     */
+    void cancel() {
+        cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return true si le jeton ou l'un de ses ancêtres a été annulé.
+     */
+    [[nodiscard]] bool isCancelled() const {
+        return cancelled.load(std::memory_order_relaxed) || (parent != nullptr && parent->isCancelled());
+    }
+
+private:
+    std::atomic<bool> cancelled{false}; // Vaut true une fois le jeton annulé.
+    const CancellationToken* parent; // Le jeton parent, nul si le jeton est indépendant.
+};
+
+/**
+ * @enum StopReason
+ * @brief La raison de l'arrêt d'une recherche.
+ */
+enum class StopReason {
+    None, // La recherche n'est pas arrêtée.
+    Target, // Le coût cible est atteint.
+    Iterations, // Le nombre maximum d'itérations est atteint.
+    Time, // Le temps imparti est écoulé.
+    Cancelled // Le jeton d'annulation a été annulé.
+};
+
+/**
+ * @class RunBudget
+ * @brief Budget d'une recherche : temps maximum, nombre maximum d'itérations, coût cible et jeton d'annulation.
+ *
+ * shouldStop est appelé à chaque itération : le nombre d'itérations et le coût cible sont comparés à chaque appel,
+ * l'horloge et le jeton d'annulation ne sont consultés que tous les CHECK_PERIOD appels. L'échéance est absolue :
+ * les budgets dérivés (child) partagent l'échéance et le jeton de leur parent.
+ */
+class RunBudget {
+public:
+    static constexpr int CHECK_PERIOD = 256; // Le nombre d'appels à shouldStop entre deux lectures de l'horloge.
+
+    /**
+     * @brief Constructeur de la classe RunBudget, le temps est décompté à partir de la construction.
+     * @param maxSeconds Le temps maximum en secondes.
+     * @param maxIterations Le nombre maximum d'itérations.
+     * @param targetCost Le coût à partir duquel la recherche s'arrête.
+     * @param token Le jeton d'annulation, nul si la recherche ne peut pas être annulée.
+     */
+    explicit RunBudget(double maxSeconds = std::numeric_limits<double>::infinity(),
+                       long long maxIterations = std::numeric_limits<long long>::max(), int targetCost = 0,
+                       const CancellationToken* token = nullptr);
+
+    /**
+     * @brief Crée un budget dérivé qui partage l'échéance, le coût cible et le jeton de ce budget.
+     * @param maxIterations Le nombre maximum d'itérations du budget dérivé, négatif pour conserver celui de ce budget.
+     * @param token Le jeton du budget dérivé, nul pour conserver celui de ce budget.
+     * @return Le budget dérivé.
+     */
+    [[nodiscard]] RunBudget child(long long maxIterations = -1, const CancellationToken* token = nullptr) const;
+
+    /**
+     * @brief Teste, de manière amortie, si la recherche doit s'arrêter.
+     * @param iteration Le nombre d'itérations effectuées.
+     * @param bestCost Le meilleur coût atteint.
+     * @return true si la recherche doit s'arrêter, la raison est alors donnée par reason().
+     */
+    bool shouldStop(long long iteration, int bestCost) {
+        if (bestCost <= targetCost) {
+            stopReason = StopReason::Target;
+            return true;
+        }
+        if (iteration >= maxIterations) {
+            stopReason = StopReason::Iterations;
+            return true;
+        }
+        if (--countdown > 0) {
+            return false;
+        }
+        countdown = CHECK_PERIOD;
+        return expired();
+    }
+
+    /**
+     * @brief Teste immédiatement l'échéance et le jeton d'annulation (boucles à gros grain).
+     * @return true si le temps est écoulé ou si la recherche est annulée.
+     */
+    bool expired();
+
+    /**
+     * @return Le temps écoulé en secondes depuis la construction du budget racine.
+     */
+    [[nodiscard]] double elapsedSeconds() const;
+
+    /**
+     * @return Le temps restant en secondes avant l'échéance (infini si aucune).
+     */
+    [[nodiscard]] double remainingSeconds() const;
+
+    /**
+     * @return true si le jeton d'annulation a été annulé.
+     */
+    [[nodiscard]] bool cancelled() const;
+
+    /**
+     * @return Le coût à partir duquel la recherche s'arrête.
+     */
+    [[nodiscard]] int getTargetCost() const;
+
+    /**
+     * @return Le jeton d'annulation, nul si aucun.
+     */
+    [[nodiscard]] const CancellationToken* getToken() const;
+
+    /**
+     * @return La raison du dernier arrêt signalé, StopReason::None si aucun.
+     */
+    [[nodiscard]] StopReason reason() const;
+
+private:
+    std::chrono::steady_clock::time_point start; // Le début du budget racine.
+    double maxSeconds; // Le temps maximum en secondes depuis start.
+    long long maxIterations; // Le nombre maximum d'itérations.
+    int targetCost; // Le coût à partir duquel la recherche s'arrête.
+    const CancellationToken* token; // Le jeton d'annulation, nul si aucun.
+    int countdown = CHECK_PERIOD; // Le nombre d'appels à shouldStop avant la prochaine lecture de l'horloge.
+    StopReason stopReason = StopReason::None; // La raison du dernier arrêt signalé.
+};
+
+/**
+ * @return Le jeton annulé à la réception de SIGINT ou SIGTERM, parent des jetons de toutes les recherches.
+ */
+CancellationToken& interruptToken();
+
+/**
+ * @brief Installe les gestionnaires de SIGINT et SIGTERM : le premier signal annule interruptToken() (les
+ * algorithmes rendent alors leur meilleure solution), un second signal termine le processus.
+ */
+void installInterruptHandler();
+
+/**
+ * @param reason La raison d'un arrêt.
+ * @return Le nom de la raison ("target", "iterations", "time", "cancelled" ou "none").
+ */
+const char* stopReasonName(StopReason reason);
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file SearchStats.h
+ * @brief Définit la structure SearchStats qui mesure le déroulement d'une recherche (itérations, mouvements acceptés,
+ * trace du meilleur coût au cours du temps, temps jusqu'à la première coloration légale, échantillons de la
+ * trajectoire).
+ */
+
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+
+#include <vector>
+#include <utility>
+#include <string>
+#include <ostream>
+
+/**
+ * @struct TraceSample
+ * @brief Un échantillon de la trajectoire d'une recherche.
+ */
+struct TraceSample {
+    double time; // Le temps de l'échantillon.
+    double temperature; // La température courante, 0 pour les algorithmes sans température.
+    int cost; // Le nombre de conflits de la solution courante.
+};
+
+/**
+ * @struct SearchStats
+ * @brief Mesures d'une recherche, remplies par les algorithmes et exportées par le mode benchmark.
+ *
+ * Les temps sont exprimés en secondes depuis le début de la recherche. Les compteurs sont incrémentés dans les
+ * boucles des algorithmes, les échantillons ne sont relevés que toutes les SAMPLE_PERIOD itérations afin que la
+ * mesure reste négligeable devant le coût d'un mouvement. Le nombre d'échantillons est borné par MAX_SAMPLES : une
+ * fois la borne atteinte, un échantillon sur deux est supprimé et l'intervalle entre deux échantillons est doublé.
+ */
+struct SearchStats {
+    static constexpr long long SAMPLE_PERIOD = 1024; // Le nombre d'itérations entre deux échantillons.
+    static constexpr size_t MAX_SAMPLES = 16384; // Le nombre maximal d'échantillons conservés (pair).
+
+    long long iterations = 0; // Le nombre d'itérations (ou de mouvements évalués).
+    long long acceptedMoves = 0; // Le nombre de mouvements appliqués à la solution courante.
+    long long uphillMoves = 0; // Le nombre de mouvements acceptés qui augmentent le nombre de conflits.
+    double elapsedSeconds = 0; // La durée de la recherche.
+    double timeToLegal = -1; // Le temps de la première coloration sans conflit, -1 si aucune n'a été trouvée.
+    std::vector<std::pair<double, int>> bestTrace; // Les couples (temps, meilleur coût) à chaque amélioration.
+    std::vector<TraceSample> samples; // Les échantillons de la trajectoire, par temps croissant.
+    std::vector<std::pair<std::string, double>> phases; // La durée de chaque phase d'un enchaînement d'algorithmes.
+    long long sampleStride = 1; // Le nombre d'appels à sample par échantillon conservé.
+    long long sampleCalls = 0; // Le nombre d'appels à sample.
+
+    /**
+     * @brief Enregistre une amélioration du meilleur coût.
+     * @param time Le temps de l'amélioration.
+     * @param cost Le nouveau meilleur coût.
+     */
+    void recordBest(double time, int cost) {
+        bestTrace.emplace_back(time, cost);
+        if (cost == 0 && timeToLegal < 0) {
+            timeToLegal = time;
+        }
+    }
+
+    /**
+     * @brief Relève un échantillon de la trajectoire, seul un appel sur sampleStride est conservé.
+     * @param time Le temps de l'échantillon.
+     * @param temperature La température courante.
+     * @param cost Le nombre de conflits de la solution courante.
+     */
+    void sample(double time, double temperature, int cost) {
+        if (sampleCalls++ % sampleStride != 0) {
+            return;
+        }
+        if (samples.size() >= MAX_SAMPLES) {
+            // MAX_SAMPLES étant pair, l'appel courant et les échantillons conservés tombent sur le nouvel intervalle
+            thinSamples();
+            sampleStride *= 2;
+        }
+        samples.push_back({time, temperature, cost});
+    }
+
+    /**
+     * @brief Supprime un échantillon sur deux (les indices impairs).
+     */
+    void thinSamples() {
+        size_t kept = 0;
+        for (size_t i = 0; i < samples.size(); i += 2) {
+            samples[kept++] = samples[i];
+        }
+        samples.resize(kept);
+    }
+
+    /**
+     * @return La proportion de mouvements évalués qui ont été appliqués, 0 si aucun mouvement n'a été évalué.
+     */
+    [[nodiscard]] double acceptanceRate() const {
+        return iterations > 0 ? static_cast<double>(acceptedMoves) / static_cast<double>(iterations) : 0.0;
+    }
+
+    /**
+     * @return Le nombre de mouvements évalués par seconde, 0 si la durée est nulle.
+     */
+    [[nodiscard]] double movesPerSecond() const {
+        return elapsedSeconds > 0 ? static_cast<double>(iterations) / elapsedSeconds : 0.0;
+    }
+
+    /**
+     * @brief Ajoute les mesures d'une recherche lancée après celle-ci (enchaînement d'algorithmes).
+     * @param next Les mesures de la recherche suivante.
+     * @param offset Le temps de début de la recherche suivante, relatif au début de celle-ci.
+     * @param phase Le nom de la phase, sa durée est ajoutée à phases s'il n'est pas vide.
+     */
+    void append(const SearchStats& next, double offset, const std::string& phase = "") {
+        iterations += next.iterations;
+        acceptedMoves += next.acceptedMoves;
+        uphillMoves += next.uphillMoves;
+        for (const auto& [time, cost] : next.bestTrace) {
+            if (bestTrace.empty() || cost < bestTrace.back().second) {
+                recordBest(offset + time, cost);
+            }
+        }
+        // Les échantillons de next sont déjà espacés par son propre intervalle : ils ne repassent pas par sample
+        for (const TraceSample& point : next.samples) {
+            samples.push_back({offset + point.time, point.temperature, point.cost});
+        }
+        while (samples.size() > MAX_SAMPLES) {
+            thinSamples();
+            sampleStride *= 2;
+        }
+        if (!phase.empty()) {
+            phases.emplace_back(phase, next.elapsedSeconds);
+        }
+    }
+};
+
+/**
+ * @brief Fusionne les mesures de recherches exécutées en parallèle depuis le même instant.
+ * Les compteurs sont additionnés, la trace conserve, au cours du temps, le meilleur coût toutes recherches
+ * confondues et les échantillons de toutes les recherches sont triés par temps, puis éclaircis jusqu'à MAX_SAMPLES.
+ * @param parallel Les mesures des recherches parallèles.
+ * @return Les mesures fusionnées.
+ */
+SearchStats mergeParallelStats(const std::vector<SearchStats>& parallel);
+
+/**
+ * @brief Obtient le pic de mémoire résidente du processus.
+ * @return Le pic de mémoire résidente en kilo-octets, -1 si la mesure n'est pas disponible.
+ */
+long peakResidentMemoryKb();
+
+/**
+ * @brief Écrit les échantillons de la trajectoire au format CSV (time,temperature,cost), précédés d'une ligne d'en-tête.
+ * @param out Le flux de sortie.
+ * @param stats Les mesures de la recherche.
+ */
+void writeTraceCsv(std::ostream& out, const SearchStats& stats);
+
+#endif
@@ -0,0 +1,131 @@
+/**
+ * @file SimulatedAnnealing.h
+ * @brief Définit le recuit simulé (une trajectoire ou plusieurs en parallèle) et la recherche locale, construits sur
+ * le noyau annealingKernel.
+ */
+
+#ifndef SIMULATEDANNEALING_H
+#define SIMULATEDANNEALING_H
+
+#include "Graph.h"
+#include "Annealing.h"
+#include "Checkpoint.h"
+#include "RunBudget.h"
+#include "SearchStats.h"
+#include <string>
+
+/**
+ * @struct MultiStartResult
+ * @brief Résultat du recuit simulé multi-départ.
+ */
+struct MultiStartResult {
+    AnnealingResult best; // Le résultat de la meilleure trajectoire.
+    int bestReplica = 0; // L'indice de la meilleure trajectoire.
+    long long totalIterations = 0; // Le nombre d'itérations de toutes les trajectoires.
+    SearchStats stats; // Les mesures des trajectoires fusionnées.
+};
+
+/**
+ * @brief Une trajectoire du recuit simulé, appliquée en place sur currentSol.
+ *
+ * Instancie le noyau annealingKernel avec le générateur choisi, le refroidissement géométrique (la température est
+ * multipliée par coolingRate toutes les 10 itérations) et le mouvement de recoloration, mélangé aux échanges de
+ * chaînes de Kempe si kempeRate > 0.
+ *
+ * @param currentSol La solution courante, modifiée en place.
+ * @param k Le nombre de couleur utilisable.
+ * @param initTemp La température initiale.
+ * @param coolingRate Le coefficient de refroidissement.
+ * @param nb_changes Nombre de changement de couleur dans le voisinage.
+ * @param kempeRate La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+ * @param budget Le budget de la trajectoire (temps, itérations, coût cible, annulation).
+ * @param seed La graine du générateur aléatoire.
+ * @param onTarget Jeton annulé par la trajectoire lorsqu'elle atteint le coût cible. Peut être nul.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param engine Le générateur aléatoire : "xoshiro" (xoshiro256**) ou "mt19937".
+ * @param source Le fichier source du graphe et la renumérotation de ses noeuds, comparés à ceux du point de reprise.
+ * @param resume Le point de reprise à partir duquel la trajectoire continue, nul pour partir de currentSol.
+ * @param checkpoints Le thread d'écriture des points de reprise, nul pour ne pas en écrire.
+ * @return Le résultat de la trajectoire.
+ * @throw std::invalid_argument si le point de reprise ne correspond pas au graphe (nombre de noeuds et d'arêtes,
+ * fichier source, renumérotation) ou aux paramètres de la trajectoire (k, générateur, initTemp, coolingRate,
+ * nb_changes, kempeRate, conflictSampling).
+ */
+AnnealingResult annealingRun(Graph& currentSol, int k, double initTemp, double coolingRate, int nb_changes,
+                             double kempeRate, const RunBudget& budget, unsigned seed, CancellationToken* onTarget,
+                             bool conflictSampling, const std::string& engine,
+                             const GraphSource& source = GraphSource(), const AnnealingCheckpoint* resume = nullptr,
+                             CheckpointWriter* checkpoints = nullptr);
+
+/**
+ * @brief Algorithme du récuit simulé.
+ * @param graph Graphe à colorier.
+ * @param k Le nombre de couleur utilisable.
+ * @param initTemp La température initiale.
+ * @param coolingRate Le coefficient de refroidissement.
+ * @param nb_changes Nombre de changement de couleur dans le voisinage.
+ * @param kempeRate La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+ * @param budget Le budget de la recherche (temps, itérations, coût cible, annulation).
+ * @param seed La graine du générateur aléatoire.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param engine Le générateur aléatoire : "xoshiro" (xoshiro256**) ou "mt19937".
+ * @param source Le fichier source du graphe et la renumérotation de ses noeuds, comparés à ceux du point de reprise.
+ * @param resume Le point de reprise à partir duquel la recherche continue, nul pour partir de la coloration du graphe.
+ * @param checkpoints Le thread d'écriture des points de reprise, nul pour ne pas en écrire.
+ * @return Le résultat de la recherche, dont la meilleure coloration rencontrée (y compris si la recherche est
+ * interrompue). Le graphe n'est pas modifié.
+ * @throw std::invalid_argument si le point de reprise ne correspond pas au graphe (nombre de noeuds et d'arêtes,
+ * fichier source, renumérotation) ou aux paramètres de la trajectoire (k, générateur, initTemp, coolingRate,
+ * nb_changes, kempeRate, conflictSampling).
+ */
+AnnealingResult simulatedAnnealing(const Graph& graph, int k, double initTemp, double coolingRate, int nb_changes,
+                                   double kempeRate, const RunBudget& budget, unsigned seed,
+                                   bool conflictSampling = false, const std::string& engine = "xoshiro",
+                                   const GraphSource& source = GraphSource(),
+                                   const AnnealingCheckpoint* resume = nullptr,
+                                   CheckpointWriter* checkpoints = nullptr);
+
+/**
+ * @brief Recuit simulé multi-départ : numThreads trajectoires indépendantes lancées en parallèle.
+ *
+ * Chaque trajectoire possède sa propre graine et sa propre coloration, la table d'adjacence du graphe est partagée
+ * en lecture seule. Toutes les trajectoires s'arrêtent dès que l'une d'elles atteint le coût cible du budget.
+ *
+ * @param graph Graphe à colorier, sa coloration sert de solution initiale à chaque trajectoire.
+ * @param k Le nombre de couleur utilisable.
+ * @param initTemp La température initiale.
+ * @param coolingRate Le coefficient de refroidissement.
+ * @param nb_changes Nombre de changement de couleur dans le voisinage.
+ * @param kempeRate La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+ * @param budget Le budget de chaque trajectoire (temps, itérations, coût cible, annulation).
+ * @param numThreads Le nombre de trajectoires (et de threads).
+ * @param baseSeed La graine dont sont dérivées les graines des trajectoires.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param engine Le générateur aléatoire : "xoshiro" (xoshiro256**) ou "mt19937".
+ * @return Le résultat de la meilleure trajectoire et les mesures fusionnées. Le graphe n'est pas modifié.
+ * @throw std::invalid_argument si numThreads < 1.
+ */
+MultiStartResult simulatedAnnealingMultiStart(const Graph& graph, int k, double initTemp, double coolingRate,
+                                              int nb_changes, double kempeRate, const RunBudget& budget, int numThreads,
+                                              unsigned baseSeed, bool conflictSampling = false,
+                                              const std::string& engine = "xoshiro");
+
+/**
+ * @brief Algorithme de recherche local, choisi à chaque tour un noeud aléatoirement parmi les noeuds en conflit et
+ * lui donne la couleur qui minimise les conflits. La recherche s'arrête dès que la coloration est légale ou que le
+ * budget est épuisé.
+ *
+ * Avec kempe, lorsqu'aucune couleur ne diminue les conflits du noeud (plateau), la chaîne de Kempe du noeud vers
+ * l'une des couleurs de moindre conflit est évaluée et échangée si elle diminue le nombre de conflits.
+ *
+ * @param graph Graphe à colorier.
+ * @param k Le nombre de couleur utilisable.
+ * @param budget Le budget de la recherche (temps, itérations, coût cible, annulation).
+ * @param seed La graine du générateur aléatoire.
+ * @param stats Les mesures de la recherche, remplies si non nul.
+ * @param kempe true pour essayer les chaînes de Kempe sur les plateaux.
+ */
+void localResearch(Graph& graph, int k, RunBudget budget, unsigned seed, SearchStats* stats = nullptr,
+                   bool kempe = false);
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file Solver.h
+ * @brief Définit l'interface Solver commune aux algorithmes de k-coloration, leurs paramètres (SolverOptions) et leur
+ * résultat (SolveResult), pour lancer plusieurs résolutions sur un même graphe chargé une seule fois.
+ */
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "Graph.h"
+#include "Checkpoint.h"
+#include "RunBudget.h"
+#include "SearchStats.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct SolverOptions
+ * @brief Paramètres des algorithmes lancés après l'heuristique gloutonne.
+ */
+struct SolverOptions {
+    // Heuristique de la solution initiale : "greedy" (ordre des degrés) ou "dsatur"
+    std::string init = "dsatur";
+    // Choix de l'algorithme : "pipeline" (recuit puis recherche locale), "tabucol", "partialcol", "tempering" ou
+    // "hybrid"
+    std::string solver = "pipeline";
+    // Paramètres du recuit simulé
+    double initTemp = 1000;
+    double coolingRate = 0.995;
+    long long maxIter = 75000;
+    int nbChanges = 1;
+    // Probabilité d'un échange de chaîne de Kempe dans le recuit (la recherche locale les essaie si elle est > 0)
+    double kempeRate = 0;
+    int timeLimit = 60;
+    // Tirage des noeuds du recuit simulé parmi les noeuds en conflit uniquement
+    bool conflictSampling = false;
+    // Générateur aléatoire du recuit simulé (xoshiro ou mt19937)
+    std::string engine = "xoshiro";
+    // Nombre de conflits à partir duquel les algorithmes s'arrêtent
+    int targetConflicts = 0;
+    // Points de reprise du recuit simulé : fichier (vide si aucun), période en secondes et état repris (nul si aucun)
+    std::string checkpointFile;
+    double checkpointPeriod = 60;
+    const AnnealingCheckpoint* resume = nullptr;
+    // Fichier source du graphe et renumérotation de ses noeuds, enregistrés dans les points de reprise
+    GraphSource graphSource;
+    // Nombre de trajectoires parallèles du recuit simulé (ou d'enfants par génération de l'algorithme hybride)
+    int numThreads = 1;
+    // Paramètres des recherches tabou (TabuCol et PartialCol)
+    long long tabuIter = 100000000;
+    // Paramètres de l'échange de répliques
+    int numReplicas = 8;
+    double minTemp = 0.1;
+    double maxTemp = 1.5;
+    int exchangeInterval = 1000;
+    // Paramètres de l'algorithme évolutionnaire hybride
+    int populationSize = 10;
+    long long childIter = 10000;
+    // Graine du générateur aléatoire (par défaut tirée de l'horloge)
+    unsigned seed = static_cast<unsigned>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+};
+
+/**
+ * @struct SolveResult
+ * @brief Résultat d'une résolution : meilleure coloration, mesures et valeurs propres à l'algorithme.
+ */
+struct SolveResult {
+    std::vector<int> coloring; // La meilleure coloration trouvée, une couleur par noeud.
+    int conflicts = 0; // Le nombre de conflits de coloring.
+    SearchStats stats; // Les mesures, relatives au début de la résolution, avec la durée de chaque phase.
+    std::vector<std::pair<std::string, double>> details; // Les valeurs propres à l'algorithme (libellé, valeur).
+};
+
+/**
+ * @class Solver
+ * @brief Algorithme de k-coloration. Une résolution part de la coloration d'un graphe sans le modifier : la
+ * topologie est partagée en lecture seule, plusieurs résolutions peuvent donc être lancées simultanément sur le même
+ * graphe chargé.
+ */
+class Solver {
+public:
+    virtual ~Solver() = default;
+
+    /**
+     * @return Le nom de l'algorithme ("pipeline", "tabucol", ...).
+     */
+    [[nodiscard]] virtual std::string getName() const = 0;
+
+    /**
+     * @brief Lance l'algorithme à partir de la coloration courante du graphe.
+     * @param graph Le graphe, sa coloration (couleurs dans [0, k-1]) sert de solution initiale.
+     * @param k Le nombre de couleur utilisable.
+     * @param options Les paramètres des algorithmes, dont la graine et les limites de temps et d'itérations.
+     * @param token Le jeton d'annulation de la résolution, peut être nul.
+     * @return Le résultat, y compris si la résolution est annulée.
+     * @throw std::invalid_argument si les paramètres ne conviennent pas à l'algorithme.
+     */
+    virtual SolveResult solve(const Graph& graph, int k, const SolverOptions& options,
+                              CancellationToken* token = nullptr) const = 0;
+};
+
+/**
+ * @return Les noms des algorithmes disponibles.
+ */
+const std::vector<std::string>& solverNames();
+
+/**
+ * @brief Crée l'algorithme de nom donné.
+ * @param name Le nom de l'algorithme (voir solverNames).
+ * @return L'algorithme.
+ * @throw std::invalid_argument si le nom est inconnu.
+ */
+std::unique_ptr<Solver> createSolver(const std::string& name);
+
+/**
+ * @brief Colorie le graphe avec l'heuristique constructive choisie.
+ * @param graph Le graphe à colorier.
+ * @param k Le nombre maximal de couleurs à utiliser.
+ * @param options Les paramètres des algorithmes (heuristique init).
+ */
+void initialColoring(Graph& graph, int k, const SolverOptions& options);
+
+#endif
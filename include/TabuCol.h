@@ -0,0 +1,92 @@
+/**
+ * @file TabuCol.h
+ * @brief Définit la classe TabuCol, une recherche tabou pour la k-coloration basée sur une table de conflits
+ * noeud x couleur maintenue de manière incrémentale.
+ */
+
+#ifndef TABUCOL_H
+#define TABUCOL_H
+
+#include "Graph.h"
+#include "SearchStats.h"
+#include "RunBudget.h"
+#include <vector>
+#include <random>
+
+/**
+ * @class TabuCol
+ * @brief Recherche tabou (Hertz & de Werra, Galinier & Hao) sur les k-colorations complètes.
+ *
+ * La table adjacentColors[v * k + c] contient le nombre de voisins de v ayant la couleur c. Elle est mise à jour
+ * en O(degré) à chaque mouvement, ce qui permet d'évaluer n'importe quel mouvement (v, c) en O(1). À chaque
+ * itération, le meilleur mouvement non tabou parmi les noeuds en conflit est appliqué. Un mouvement tabou est
+ * accepté s'il améliore la meilleure solution rencontrée (aspiration). La durée tabou est dynamique (proportionnelle
+ * au nombre de noeuds en conflit) et réactive : elle augmente lorsque la recherche stagne.
+ */
+class TabuCol {
+public:
+    /**
+     * @brief Constructeur de la classe TabuCol.
+     * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale.
+     * @param k Le nombre de couleur utilisable.
+     * @param seed La graine du générateur aléatoire.
+     * @throw std::invalid_argument si k est inférieur à 1 ou si un noeud a une couleur hors de [0, k-1].
+     */
+    TabuCol(Graph& graph, int k, unsigned seed);
+
+    /**
+     * @brief Lance la recherche tabou puis applique la meilleure coloration rencontrée au graphe, y compris si la
+     * recherche est interrompue.
+     * @param budget Le budget de la recherche (temps, itérations, coût cible, annulation).
+     * @return Le nombre de conflits de la meilleure coloration rencontrée.
+     */
+    int run(RunBudget budget);
+
+    /**
+     * @brief Remplace la solution initiale sans réallouer les tables (utilisé pour enchaîner plusieurs recherches sur
+     * le même graphe).
+     * @param coloring La nouvelle solution initiale, une couleur par noeud.
+     * @throw std::invalid_argument si la taille ne correspond pas au graphe ou si une couleur est hors de [0, k-1].
+     */
+    void reset(const std::vector<int>& coloring);
+
+    /**
+     * @return Le nombre d'itérations effectuées lors du dernier appel à run.
+     */
+    [[nodiscard]] long long getIterations() const;
+
+    /**
+     * @return Les mesures du dernier appel à run.
+     */
+    [[nodiscard]] const SearchStats& getStats() const;
+
+private:
+    /**
+     * @brief Change la couleur d'un noeud et met à jour la table des couleurs adjacentes, le nombre de conflits
+     * et l'ensemble des noeuds en conflit.
+     * @param v L'ID du noeud.
+     * @param newColor La nouvelle couleur.
+     */
+    void applyMove(int v, int newColor);
+
+    /**
+     * @brief Met à jour l'appartenance d'un noeud à l'ensemble des noeuds en conflit.
+     * @param v L'ID du noeud.
+     */
+    void updateConflicting(int v);
+
+    Graph& graph; // Le graphe à colorier.
+    int k; // Le nombre de couleur utilisable.
+    int numNodes; // Le nombre de noeuds du graphe.
+    std::mt19937 rng; // Le générateur aléatoire.
+    std::vector<int> colors; // La couleur courante de chaque noeud.
+    std::vector<int> adjacentColors; // Table n x k : nombre de voisins de v ayant la couleur c.
+    std::vector<long long> tabuUntil; // Table n x k : itération jusqu'à laquelle le mouvement (v, c) est tabou.
+    std::vector<int> conflicting; // Les noeuds en conflit (ordre quelconque).
+    std::vector<int> conflictingPos; // Position de chaque noeud dans conflicting, -1 s'il n'est pas en conflit.
+    int cost; // Le nombre de conflits de la solution courante.
+    long long iterations; // Le nombre d'itérations effectuées.
+    SearchStats stats; // Les mesures du dernier appel à run.
+};
+
+#endif
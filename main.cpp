@@ -1,345 +1,837 @@
 #include <algorithm>
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <vector>
 #include <string>
 #include <stdexcept>
-#include <random>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <filesystem>
 #include "include/Node.h"
 #include "include/Graph.h"
+#include "include/GraphLoader.h"
+#include "include/GraphReduction.h"
+#include "include/GraphOrdering.h"
+#include "include/SearchStats.h"
+#include "include/Checkpoint.h"
+#include "include/Coloring.h"
+#include "include/Solver.h"
+#include "include/CliqueBound.h"
 
 
 /**
- * @brief Lit un graphe à partir d'un fichier au format DIMACS et crée un objet Graph correspondant.
- *
- * Cette fonction prend en entrée un nom de fichier, extrait les informations du graphe au format DIMACS, puis crée et
- * renvoie un objet Graph représentant le graphe.
- *
- * @param filename Le nom du fichier contenant les données du graphe au format DIMACS.
- * @return Un objet Graph représentant le graphe extrait du fichier.
- * @throw std::invalid_argument si le fichier ne peut pas être ouvert ou s'il y a des erreurs dans le format du fichier.
+ * @brief Lance l'algorithme choisi sur la coloration courante du graphe et y applique la meilleure coloration trouvée.
+ * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale.
+ * @param k Le nombre de couleur utilisable.
+ * @param options Les paramètres des algorithmes.
+ * @param stats Les mesures de la recherche, complétées par celles de l'algorithme.
+ * @param origin L'instant auquel sont relatifs les temps de stats.
+ * @param log Le flux des messages, nul pour n'en écrire aucun (travaux du mode manifeste).
+ * @return Le nombre de conflits de la coloration finale.
  */
-Graph readGraphFromFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::invalid_argument("Impossible d'ouvrir le fichier: " + filename);
-    }
-
-    int numNodes = 0;
-    int numEdges = 0;
-
-    std::string line; // Déclaration de la variable 'line'
-
-    while (std::getline(file, line)) {
-        if (line.find("p edge ") == 0) {
-            std::istringstream iss(line);
-            iss.ignore(7);
-            if (iss >> numNodes >> numEdges) {
-                std::cout << "Nombre de noeud: " << numNodes << ", Nombre d'arrete: " << numEdges << std::endl;
+static int runSolver(Graph& graph, int k, const SolverOptions& options, SearchStats& stats,
+                     std::chrono::high_resolution_clock::time_point origin, std::ostream* log) {
+    std::unique_ptr<Solver> solver = createSolver(options.solver);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SolveResult result = solver->solve(graph, k, options, &interruptToken());
+    graph.setColoring(result.coloring);
+    stats.append(result.stats, std::chrono::duration<double>(start_time - origin).count());
+    stats.phases.insert(stats.phases.end(), result.stats.phases.begin(), result.stats.phases.end());
+    if (log) {
+        for (const auto& [label, value] : result.details) {
+            *log << label << " : ";
+            if (value == static_cast<double>(static_cast<long long>(value))) {
+                *log << static_cast<long long>(value);
             } else {
-                std::cerr << "Impossible d'extraire numNodes et numEdges." << std::endl;
+                *log << value;
             }
-            break;
-        } else {
-            continue;
+            *log << std::endl;
         }
+        *log << "Dans le graphe apres " << solver->getName() << " il y a : " << result.conflicts << " conflit(s)"
+             << std::endl;
     }
-    // Creation du graphe
-    Graph graph(numNodes);
-
-    while (std::getline(file, line)) {
-        int u, v;
-        if (sscanf(line.c_str(), "e %d %d", &u, &v) == 2) {
-            if (u >= 1 && v >= 1) {
-                // Ajoutez les arêtes au graphe
-                graph.addEdge(u - 1, v - 1);
-            } else {
-                throw std::invalid_argument("Les IDs des arêtes doivent être supérieurs ou égaux à 1.");
-            }
-        } else {
-            throw std::invalid_argument("Impossible de lire les arêtes: " + filename);
-        }
-    }
-    file.close();
-    return graph;
+    return result.conflicts;
 }
 
 /**
- * @brief Colorie le graphe avec un algorithme glouton en utilisant au plus k couleurs.
- *
- * @param graph Le graphe à colorier.
- * @param k Le nombre maximal de couleurs à utiliser.
+ * @struct DescentStep
+ * @brief Résultat d'une tentative de la descente sur k.
  */
-void greedyColoring(Graph& graph, int k) {
-
-    std::vector<Node>& nodes = graph.getNodes();
-    int numNodes = graph.getNumNodes();
+struct DescentStep {
+    int k; // Le nombre de couleur utilisable.
+    int startConflicts; // Le nombre de conflits du point de départ.
+    int conflicts; // Le nombre de conflits de la coloration finale.
+    long long iterations; // Le nombre d'itérations de l'algorithme.
+    double seconds; // La durée de la tentative.
+};
 
-    // Créez un vecteur d'indices pour trier les noeuds
-    std::vector<int> nodeIndices(numNodes);
-    for (int i = 0; i < numNodes; i++) {
-        nodeIndices[i] = i;
+/**
+ * @brief Cherche le plus petit k pour lequel l'algorithme trouve une coloration légale.
+ *
+ * La descente part d'une coloration initiale légale (au plus degré maximum + 1 couleurs) et diminue k d'une unité
+ * tant que l'algorithme trouve une coloration sans conflit dans le temps imparti. Chaque tentative part de la
+ * dernière coloration légale dont une classe de couleur a été supprimée (removeColorClass). La descente s'arrête
+ * sans autre tentative dès que k atteint la borne inférieure : la coloration est alors optimale.
+ *
+ * @param graph Le graphe à colorier, il reçoit la coloration légale avec le plus petit nombre de couleurs trouvé.
+ * @param targetK La valeur de k à laquelle la descente s'arrête, 1 pour descendre le plus loin possible.
+ * @param lowerBound Une borne inférieure du nombre chromatique (taille d'une clique).
+ * @param options Les paramètres des algorithmes (timeLimit est le temps maximum de chaque tentative).
+ * @param stats Les mesures de la recherche, complétées par celles de chaque tentative.
+ * @param origin L'instant auquel sont relatifs les temps de stats.
+ * @param steps Les résultats de chaque tentative, dans l'ordre.
+ * @return Le plus petit nombre de couleurs d'une coloration légale trouvée.
+ */
+static int kDescent(Graph& graph, int targetK, int lowerBound, SolverOptions options, SearchStats& stats,
+                    std::chrono::high_resolution_clock::time_point origin, std::vector<DescentStep>& steps) {
+    int maxDegree = 0;
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        maxDegree = std::max(maxDegree, graph.getDegree(v));
     }
-
-    // Triez les indices en fonction du degré des noeuds (nombre de voisins)
-    std::sort(nodeIndices.begin(), nodeIndices.end(), [&nodes](int a, int b) {
-        return nodes[a].getNeighbors().size() > nodes[b].getNeighbors().size();
-    });
-
-
-    std::vector<int> colorAssigned(numNodes, -1); // Initialise toutes les couleurs à -1 (non attribuées)
-
-    for (int i : nodeIndices) {
-        Node& node = nodes[i];
-        std::vector<bool> neighborColors(k, false);
-
-        // Parcourez les voisins et marquez leurs couleurs comme utilisées
-        for (int neighborID : node.getNeighbors()) {
-            int neighborColor = colorAssigned[neighborID];
-            if (neighborColor >= 0) {
-                neighborColors[neighborColor] = true;
-            }
-        }
-
-        int chosenColor = -1;
-
-        // Attribuez la première couleur non utilisée
-        for (int color = 0; color < k; color++) {
-            if (!neighborColors[color]) {
-                chosenColor = color;
-                break;
-            }
+    initialColoring(graph, maxDegree + 1, options);
+    int bestK = 0;
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        bestK = std::max(bestK, graph.getColor(v) + 1);
+    }
+    std::vector<int> bestColoring = graph.getColoring();
+    std::cout << "Coloration initiale (" << options.init << ") legale avec " << bestK << " couleur(s)" << std::endl;
+
+    while (bestK > std::max({targetK, lowerBound, 1})) {
+        int k = bestK - 1;
+        auto start_time_k = std::chrono::high_resolution_clock::now();
+        removeColorClass(graph, k);
+        DescentStep step{k, graph.countConflicts(), 0, 0, 0};
+        std::cout << "--- k = " << k << " (depart : " << step.startConflicts << " conflit(s)) ---" << std::endl;
+
+        SearchStats attemptStats;
+        step.conflicts = step.startConflicts == 0 ? 0 : runSolver(graph, k, options, attemptStats, start_time_k,
+                                                                            &std::cout);
+        attemptStats.elapsedSeconds = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start_time_k).count();
+        step.iterations = attemptStats.iterations;
+        step.seconds = attemptStats.elapsedSeconds;
+        stats.append(attemptStats, std::chrono::duration<double>(start_time_k - origin).count(),
+                     "k=" + std::to_string(k));
+        steps.push_back(step);
+        if (step.conflicts > 0 || interruptToken().isCancelled()) {
+            break;
         }
+        bestK = k;
+        bestColoring = graph.getColoring();
+        options.seed++;
+    }
+    if (bestK <= lowerBound) {
+        std::cout << "k = " << bestK << " est optimal : egal a la borne inferieure (clique)" << std::endl;
+    }
+    graph.setColoring(bestColoring);
+    return bestK;
+}
 
-        if (chosenColor == -1) {
-            // Si aucune couleur non utilisée n'est trouvée, attribuez la couleur la moins utilisée parmi les voisins
-            std::vector<int> neighborColorCount(k, 0);
-            for (int neighborID : node.getNeighbors()) {
-                int neighborColor = colorAssigned[neighborID];
-                if (neighborColor != -1){
-                    neighborColorCount[neighborColor]++;
-                }
-            }
-
-            int minNeighborCount = k + 1;
-            for (int color = 0; color < k; color++) {
-                if (neighborColorCount[color] < minNeighborCount) {
-                    chosenColor = color;
-                    minNeighborCount = neighborColorCount[color];
-                }
-            }
+/**
+ * @brief Échappe une chaîne pour l'écrire dans un document JSON.
+ * @param text La chaîne.
+ * @return La chaîne échappée, sans les guillemets.
+ */
+static std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
         }
-        node.setColor(chosenColor); // Mettez à jour la couleur du noeud
-        colorAssigned[i] = chosenColor;
+        escaped += c;
     }
-    graph.setConflictCount();
+    return escaped;
 }
 
 /**
- * @brief Algorithme du récuit simulé.
- * @param graph Graphe à colorier.
+ * @brief Écrit le compte rendu d'une exécution sous la forme d'un objet JSON sur une ligne.
+ * @param out Le flux de sortie.
+ * @param filename Le fichier du graphe.
  * @param k Le nombre de couleur utilisable.
- * @param initTemp La température initiale.
- * @param coolingRate Le coefficient de refroidissement.
- * @param maxIter Le nombre maximum d'itération.
- * @param nb_changes Nombre de changement de couleur dans le voisinage.
- * @param maxExecutionTimeInSeconds Temps execution maximum de la fonction.
- * @return Le graphe colorié à la fin de l'algorithme.
+ * @param solver L'algorithme utilisé.
+ * @param seed La graine du générateur aléatoire.
+ * @param graph Le graphe colorié.
+ * @param loadTime Le temps de chargement du graphe (en secondes).
+ * @param bound La borne inférieure du nombre chromatique.
+ * @param ordering La renumérotation des noeuds ("none" si aucune).
+ * @param locality La localité de la table d'adjacence du graphe parcouru par les algorithmes.
+ * @param greedyConflicts Le nombre de conflits de la solution gloutonne.
+ * @param bestConflicts Le nombre de conflits de la solution finale.
+ * @param stats Les mesures de la recherche, dont les temps sont relatifs à la fin du chargement.
+ * @param interrupted true si la recherche a été interrompue par un signal.
+ * @param job Le numéro du travail en mode manifeste, négatif s'il n'est pas écrit. Le pic de mémoire (peakRssKb) est
+ * celui de tout le processus : il n'est écrit que hors du mode manifeste, où les travaux partagent le processus.
  */
-Graph simulatedAnnealing(Graph& graph, int k, double initTemp, double coolingRate, int maxIter, int nb_changes, int maxExecutionTimeInSeconds) {
-
-    //initialisation des paramètres et de la solution courante
-    Graph currentSol = graph.clone();
-    Graph best_sol_encountered = graph.clone();
-    double currentCost = currentSol.countConflicts();
-    double best_value_encountered = best_sol_encountered.countConflicts();
-    double temperature = initTemp;
-    int index_best_sol = 0;
-    int index_last_change = 0;
-    long long bestSolTime = 0;
-    // Creation d'une seed aléatoire différente dans chaque thread
-    unsigned seed = static_cast<unsigned>(
-            std::chrono::high_resolution_clock::now().time_since_epoch().count());
-    std::mt19937 rng(seed);
-    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+static void writeReportRecord(std::ostream& out, const std::string& filename, int k, const std::string& solver,
+                              unsigned seed, const Graph& graph, double loadTime, const CliqueBound& bound,
+                              const std::string& ordering, const AdjacencyLocality& locality, int greedyConflicts,
+                              int bestConflicts, const SearchStats& stats, bool interrupted, long long job = -1) {
+    out << "{";
+    if (job >= 0) {
+        out << "\"job\":" << job << ",";
+    }
+    out << "\"instance\":\"" << jsonEscape(filename) << "\",\"k\":" << k
+        << ",\"solver\":\"" << jsonEscape(solver) << "\",\"seed\":" << seed
+        << ",\"numNodes\":" << graph.getNumNodes() << ",\"numEdges\":" << graph.getNumEdges()
+        << ",\"loadTime\":" << loadTime << ",\"lowerBound\":" << bound.lowerBound()
+        << ",\"lowerBoundExact\":" << (bound.exact ? "true" : "false") << ",\"ordering\":\"" << jsonEscape(ordering)
+        << "\",\"bandwidth\":" << locality.bandwidth << ",\"meanNeighborGap\":" << locality.meanGap
+        << ",\"greedyConflicts\":" << greedyConflicts
+        << ",\"timeToLegal\":" << stats.timeToLegal << ",\"bestConflicts\":" << bestConflicts
+        << ",\"totalTime\":" << stats.elapsedSeconds << ",\"iterations\":" << stats.iterations
+        << ",\"iterationsPerSecond\":" << stats.movesPerSecond() << ",\"acceptedMoves\":" << stats.acceptedMoves
+        << ",\"uphillMoves\":" << stats.uphillMoves << ",\"acceptanceRate\":" << stats.acceptanceRate();
+    if (job < 0) {
+        out << ",\"peakRssKb\":" << peakResidentMemoryKb();
+    }
+    out << ",\"interrupted\":" << (interrupted ? "true" : "false") << ",\"phases\":{";
+    for (size_t i = 0; i < stats.phases.size(); i++) {
+        out << (i > 0 ? "," : "") << "\"" << jsonEscape(stats.phases[i].first) << "\":" << stats.phases[i].second;
+    }
+    out << "},\"trace\":[";
+    for (size_t i = 0; i < stats.bestTrace.size(); i++) {
+        out << (i > 0 ? "," : "") << "[" << stats.bestTrace[i].first << "," << stats.bestTrace[i].second << "]";
+    }
+    out << "]}\n";
+}
 
-    // Récupérer le moment où l'algorithme a commencé à s'exécuter
-    auto startTime = std::chrono::high_resolution_clock::now();
+/**
+ * @brief Ajoute le compte rendu d'une exécution au fichier de rapport, sous la forme d'un objet JSON par ligne.
+ * @param reportFile Le fichier de rapport.
+ * @param filename Le fichier du graphe.
+ * @param k Le nombre de couleur utilisable.
+ * @param solver L'algorithme utilisé.
+ * @param seed La graine du générateur aléatoire.
+ * @param graph Le graphe colorié.
+ * @param loadTime Le temps de chargement du graphe (en secondes).
+ * @param bound La borne inférieure du nombre chromatique.
+ * @param ordering La renumérotation des noeuds ("none" si aucune).
+ * @param locality La localité de la table d'adjacence du graphe parcouru par les algorithmes.
+ * @param greedyConflicts Le nombre de conflits de la solution gloutonne.
+ * @param bestConflicts Le nombre de conflits de la solution finale.
+ * @param stats Les mesures de la recherche, dont les temps sont relatifs à la fin du chargement.
+ * @param interrupted true si la recherche a été interrompue par un signal.
+ * @throw std::runtime_error si le fichier ne peut pas être ouvert.
+ */
+static void writeRunReport(const std::string& reportFile, const std::string& filename, int k,
+                           const std::string& solver, unsigned seed, const Graph& graph, double loadTime,
+                           const CliqueBound& bound, const std::string& ordering, const AdjacencyLocality& locality,
+                           int greedyConflicts, int bestConflicts, const SearchStats& stats, bool interrupted) {
+    std::ofstream out(reportFile, std::ios::app);
+    if (!out) {
+        throw std::runtime_error("Impossible d'ouvrir le fichier de rapport : " + reportFile);
+    }
+    writeReportRecord(out, filename, k, solver, seed, graph, loadTime, bound, ordering, locality, greedyConflicts,
+                      bestConflicts, stats, interrupted);
+}
 
-    //itérations de l'algo de recuit simulé
-    for (int i = 0; i < maxIter; i++) {
-        //génération du voisin aléatoire
-        Graph newSol = currentSol.clone();
-        newSol.recolorAllNodes(nb_changes, k, rng);
-        double newCost = newSol.countConflicts();
+/**
+ * @brief Écrit la coloration dans un fichier, une ligne "noeud couleur" par noeud (numérotés à partir de 1).
+ * @param outputFile Le fichier de sortie.
+ * @param graph Le graphe colorié.
+ * @throw std::runtime_error si le fichier ne peut pas être ouvert.
+ */
+static void writeColoring(const std::string& outputFile, const Graph& graph) {
+    std::ofstream out(outputFile);
+    if (!out) {
+        throw std::runtime_error("Impossible d'ouvrir le fichier de sortie : " + outputFile);
+    }
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        out << v + 1 << " " << graph.getColor(v) + 1 << "\n";
+    }
+}
 
-        // choix de garder ou non ce voisin
-        if (newCost < currentCost) {
-            currentSol = newSol.clone();
-            currentCost = newCost;
-            index_best_sol = i;
-            index_last_change = i;
-            auto currentTime = std::chrono::high_resolution_clock::now();
-            bestSolTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - startTime).count();
+/**
+ * @struct ManifestJob
+ * @brief Un travail du mode manifeste : une instance, un k, un algorithme, une graine et un temps maximum.
+ */
+struct ManifestJob {
+    std::string file; // Le fichier du graphe.
+    int k = 0; // Le nombre de couleur utilisable.
+    std::string solver; // L'algorithme.
+    unsigned seed = 0; // La graine du générateur aléatoire.
+    int timeLimit = 0; // Le temps maximum en secondes.
+    size_t graph = 0; // L'indice du graphe dans la liste des graphes distincts.
+};
 
+/**
+ * @brief Lit un manifeste : une ligne `<fichier> <k> [solver] [graine] [timeLimit]` par travail, les lignes vides et
+ * celles qui commencent par `#` sont ignorées. Un champ facultatif absent ou égal à `-` prend la valeur des options de
+ * la ligne de commande. Les chemins relatifs sont relatifs au dossier du manifeste.
+ * @param manifestFile Le fichier du manifeste.
+ * @param defaults Les options de la ligne de commande.
+ * @return Les travaux, dans l'ordre du fichier.
+ * @throw std::invalid_argument si le fichier ne peut pas être ouvert ou si une ligne est invalide (notamment si k est
+ * hors de [1, Graph::MAX_COLORS]).
+ */
+static std::vector<ManifestJob> readManifest(const std::string& manifestFile, const SolverOptions& defaults) {
+    std::ifstream in(manifestFile);
+    if (!in) {
+        throw std::invalid_argument("Impossible d'ouvrir le manifeste : " + manifestFile);
+    }
+    std::filesystem::path directory = std::filesystem::path(manifestFile).parent_path();
+    std::vector<ManifestJob> jobs;
+    std::string line;
+    for (int lineNumber = 1; std::getline(in, line); lineNumber++) {
+        std::istringstream fields(line);
+        std::string file, k, solver = "-", seed = "-", timeLimit = "-", extra;
+        if (!(fields >> file) || file[0] == '#') {
+            continue;
         }
-        else {
-            double acceptanceProbability = exp((currentCost - newCost) / temperature);
-            double randomRate = distribution(rng);
-
-            if (randomRate < acceptanceProbability) {
-                currentSol = newSol.clone();
-                currentCost = newCost;
-                index_last_change = i;
-            }
+        auto invalid = [&](const std::string& reason) {
+            return std::invalid_argument(manifestFile + ":" + std::to_string(lineNumber) + " : " + reason);
+        };
+        if (!(fields >> k)) {
+            throw invalid("k manquant");
         }
-        if (newCost < best_value_encountered) {
-            best_sol_encountered = newSol.clone();
-            best_value_encountered = newCost;
+        fields >> solver >> seed >> timeLimit;
+        if (fields >> extra) {
+            throw invalid("champ en trop : " + extra);
         }
-        if ((i % 10) == 0) {
-            temperature *= coolingRate;
+        ManifestJob job;
+        std::filesystem::path path(file);
+        job.file = path.is_relative() ? (directory / path).string() : file;
+        job.solver = solver == "-" ? defaults.solver : solver;
+        if (std::find(solverNames().begin(), solverNames().end(), job.solver) == solverNames().end()) {
+            throw invalid("algorithme inconnu : " + job.solver);
         }
-        // Vérifier si le temps d'exécution dépasse la limite
-        auto currentTime = std::chrono::high_resolution_clock::now();
-        auto elapsedTimeInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - startTime).count();
-
-        if (elapsedTimeInSeconds >= maxExecutionTimeInSeconds) {
-            // Arrêter l'exécution et retourner la meilleure solution rencontrée jusqu'à présent
-            std::cout << "Nombre d'iterations pour meilleure solution: " << index_best_sol << std::endl;
-            std::cout << "Temps pour meilleure solution: " << bestSolTime << std::endl;
-            std::cout << "Nombre d'iterations au dernier changement de solution courante: " << index_last_change << std::endl;
-            std::cout << "Temperature finale: " << temperature << std::endl;
-            return best_sol_encountered;
+        try {
+            job.k = std::stoi(k);
+            job.seed = seed == "-" ? defaults.seed : static_cast<unsigned>(std::stoul(seed));
+            job.timeLimit = timeLimit == "-" ? defaults.timeLimit : std::stoi(timeLimit);
+        } catch (const std::exception&) {
+            throw invalid("nombre invalide");
+        }
+        if (job.k <= 0 || job.k > Graph::MAX_COLORS) {
+            throw invalid("k doit être compris entre 1 et " + std::to_string(Graph::MAX_COLORS) + " : " + k);
         }
+        jobs.push_back(job);
     }
-    std::cout << "Nombre d'iterations pour meilleure solution: " << index_best_sol << std::endl;
-    std::cout << "Temps pour meilleure solution: " << bestSolTime << std::endl;
-    std::cout << "Nombre d'iterations au dernier changement de solution courante: " << index_last_change << std::endl;
-    std::cout << "Temperature finale: " << temperature << std::endl;
+    return jobs;
+}
 
-    return best_sol_encountered;
+/**
+ * @brief Nombre de threads utilisés par un algorithme.
+ * @param solver Le nom de l'algorithme.
+ * @param options Les paramètres des algorithmes.
+ * @return numReplicas pour l'échange de répliques, numThreads pour le recuit (trajectoires parallèles) et
+ * l'algorithme hybride, 1 pour les recherches tabou.
+ */
+static int solverThreads(const std::string& solver, const SolverOptions& options) {
+    if (solver == "tempering") {
+        return std::max(1, options.numReplicas);
+    }
+    if (solver == "pipeline" || solver == "hybrid") {
+        return std::max(1, options.numThreads);
+    }
+    return 1;
 }
 
 /**
- * @brief Algorithme de recherche local, choisi à chaque tour un noeud aléatoirement et lui donne la couleur qui
- * minimise les conflits.
- * @param graph Graphe à colorier.
- * @param k Le nombre de couleur utilisable.
- * @param maxIter Le nombre maximum d'itération.
+ * @brief Mode manifeste : résout tous les travaux d'un manifeste dans le même processus.
+ *
+ * Chaque graphe distinct est chargé une seule fois, sa topologie est partagée en lecture seule par tous ses travaux.
+ * Les travaux sont répartis entre numJobs threads, chacun prenant le prochain travail non commencé ; les messages des
+ * algorithmes sont supprimés et un compte rendu JSON (le format de --report, précédé du numéro du travail) est écrit
+ * sur la sortie standard dès qu'un travail se termine. Un travail dont le graphe ne peut pas être chargé ou dont
+ * l'algorithme échoue produit un objet avec un champ "error". Après SIGINT/SIGTERM, les travaux en cours rendent
+ * leur meilleure coloration et les travaux non commencés sont abandonnés.
+ *
+ * Un travail peut lui-même utiliser plusieurs threads (--threads, --replicas) : par défaut, les coeurs sont répartis
+ * entre les travaux selon le travail qui en utilise le plus, et un nombre de travaux simultanés explicite qui
+ * dépasserait le nombre de coeurs est refusé.
+ *
+ * @param manifestFile Le fichier du manifeste.
+ * @param defaults Les options de la ligne de commande, appliquées à tous les travaux.
+ * @param numJobs Le nombre de travaux exécutés simultanément, 0 pour répartir les coeurs entre les travaux.
+ * @param useCache true pour utiliser le cache binaire des graphes.
+ * @param cliqueNodes La limite de la recherche exacte de clique (borne inférieure calculée pour chaque graphe).
+ * @param ordering La renumérotation appliquée à chaque graphe après son chargement, vide si aucune.
+ * @return Le nombre de travaux en erreur.
+ * @throw std::invalid_argument si le manifeste est invalide, si numJobs < 0 ou si numJobs > 1 travaux utilisent
+ * ensemble plus de threads que de coeurs.
  */
-void localResearch(Graph& graph, int k, int maxIter) {
-    unsigned seed = static_cast<unsigned>(
-            std::chrono::high_resolution_clock::now().time_since_epoch().count());
-    std::mt19937 rng(seed);
-    std::uniform_int_distribution<int> distribution(0, graph.getNumNodes() - 1);
+static int runManifest(const std::string& manifestFile, const SolverOptions& defaults, int numJobs, bool useCache,
+                       long long cliqueNodes, const std::string& ordering) {
+    if (numJobs < 0) {
+        throw std::invalid_argument("Le nombre de travaux simultanés ne peut pas être négatif.");
+    }
+    std::vector<ManifestJob> jobs = readManifest(manifestFile, defaults);
 
-    for (int i = 0; i < maxIter; i++) {
-        int valueRng = distribution(rng);
-        Node& node = graph.getNodes()[valueRng];
-        std::vector<int> neighborColorCount(k, 0);
-        int oldColor = graph.getNodes()[valueRng].getColor();
+    // Les threads des travaux simultanés ne doivent pas dépasser le nombre de coeurs
+    int jobThreads = 1;
+    for (const ManifestJob& job : jobs) {
+        jobThreads = std::max(jobThreads, solverThreads(job.solver, defaults));
+    }
+    int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    if (numJobs == 0) {
+        numJobs = std::max(1, cores / jobThreads);
+    } else if (numJobs > 1 && static_cast<long long>(numJobs) * jobThreads > cores) {
+        throw std::invalid_argument(std::to_string(numJobs) + " travaux simultanés de " + std::to_string(jobThreads)
+                                    + " threads dépassent les " + std::to_string(cores)
+                                    + " coeurs : réduire --jobs, --threads ou --replicas.");
+    }
 
-        // Compte les conflits du à chaque couleurs
-        for (int neighborID : node.getNeighbors()) {
-            int neighborColor = graph.getNodes()[neighborID].getColor();
-            if (neighborColor != -1) {
-                neighborColorCount[neighborColor]++;
-            }
+    // Chargement de chaque graphe distinct
+    std::vector<std::string> files;
+    std::vector<Graph> graphs;
+    std::vector<double> loadTimes;
+    std::vector<CliqueBound> bounds;
+    std::vector<AdjacencyLocality> localities;
+    std::vector<std::string> loadErrors;
+    for (ManifestJob& job : jobs) {
+        auto found = std::find(files.begin(), files.end(), job.file);
+        job.graph = static_cast<size_t>(found - files.begin());
+        if (found != files.end()) {
+            continue;
         }
-
-        // Récupère le nombre minimum de conflits
-        int minValue = *std::min_element(neighborColorCount.begin(), neighborColorCount.end());
-        std::vector<int> minColors;
-
-        // Crée la liste des couleurs possibles
-        for (int color = 0; color < k; color++) {
-            if (neighborColorCount[color] == minValue) {
-                minColors.push_back(color);
+        files.push_back(job.file);
+        auto start = std::chrono::steady_clock::now();
+        try {
+            graphs.push_back(readGraphFromFile(job.file, useCache));
+            if (!ordering.empty()) {
+                // Les travaux n'écrivent pas de coloration : la permutation n'est pas conservée
+                graphs.back() = reorderGraph(graphs.back(), ordering).graph;
             }
+            loadErrors.emplace_back();
+        } catch (const std::exception& e) {
+            graphs.emplace_back();
+            loadErrors.emplace_back(e.what());
         }
-
-        // Sélection aléatoire parmi les couleurs minimales
-        std::uniform_int_distribution<int> distributionMinColors(0, static_cast<int>(minColors.size()) - 1);
-        int idxMin = minColors[distributionMinColors(rng)];
-        node.setColor(idxMin);
-
-        // Mettez à jour conflictCount en conséquence
-        for (int neighborID : node.getNeighbors()) {
-            const Node& neighbor = graph.getNode(neighborID);
-            if (neighbor.getColor() == oldColor) {
-                graph.getConflictCount()[neighborID]--; // Réduction du conflit
-                graph.getConflictCount()[node.getID()]--;
-            }
-            if (neighbor.getColor() == idxMin) {
-                graph.getConflictCount()[neighborID]++; // Augmentation du conflit
-                graph.getConflictCount()[node.getID()]++;
+        loadTimes.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        bounds.push_back(cliqueLowerBound(graphs.back(), cliqueNodes));
+        localities.push_back(adjacencyLocality(graphs.back()));
+    }
+    std::cerr << "Manifeste : " << jobs.size() << " travail(aux) sur " << files.size() << " graphe(s), "
+              << numJobs << " travail(aux) simultane(s) de " << jobThreads << " thread(s)" << std::endl;
+
+    std::mutex outputMutex;
+    std::atomic<size_t> nextJob{0};
+    std::atomic<int> failures{0};
+    auto worker = [&]() {
+        for (size_t j = nextJob++; j < jobs.size() && !interruptToken().isCancelled(); j = nextJob++) {
+            const ManifestJob& job = jobs[j];
+            std::ostringstream record;
+            try {
+                if (!loadErrors[job.graph].empty()) {
+                    throw std::runtime_error(loadErrors[job.graph]);
+                }
+                SolverOptions options = defaults;
+                options.solver = job.solver;
+                options.seed = job.seed;
+                options.timeLimit = job.timeLimit;
+                Graph graph(graphs[job.graph].getTopology());
+                auto start = std::chrono::high_resolution_clock::now();
+                SearchStats stats;
+                initialColoring(graph, job.k, options);
+                int greedyConflicts = graph.countConflicts();
+                stats.recordBest(std::chrono::duration<double>(
+                        std::chrono::high_resolution_clock::now() - start).count(), greedyConflicts);
+                // Sous la borne, aucune coloration légale n'existe : le travail rapporte la coloration initiale
+                bool belowBound = job.k < bounds[job.graph].lowerBound();
+                int bestConflicts = graph.getNumNodes() > 0 && !belowBound
+                                    ? runSolver(graph, job.k, options, stats, start, nullptr)
+                                    : greedyConflicts;
+                stats.elapsedSeconds = std::chrono::duration<double>(
+                        std::chrono::high_resolution_clock::now() - start).count();
+                writeReportRecord(record, job.file, job.k, job.solver, job.seed, graph, loadTimes[job.graph],
+                                  bounds[job.graph], ordering.empty() ? "none" : ordering, localities[job.graph],
+                                  greedyConflicts, bestConflicts, stats,
+                                  interruptToken().isCancelled(), static_cast<long long>(j));
+            } catch (const std::exception& e) {
+                failures++;
+                record.str("");
+                record << "{\"job\":" << j << ",\"instance\":\"" << jsonEscape(job.file) << "\",\"k\":" << job.k
+                       << ",\"solver\":\"" << jsonEscape(job.solver) << "\",\"seed\":" << job.seed
+                       << ",\"error\":\"" << jsonEscape(e.what()) << "\"}\n";
             }
+            std::lock_guard<std::mutex> lock(outputMutex);
+            std::cout << record.str() << std::flush;
         }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(numJobs);
+    for (int t = 0; t < numJobs; t++) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
     }
+    if (interruptToken().isCancelled()) {
+        std::cerr << "Manifeste interrompu : les travaux non commences sont abandonnes." << std::endl;
+    }
+    std::cerr << "Pic de memoire du processus : " << peakResidentMemoryKb() << " Ko" << std::endl;
+    return failures;
 }
 
-
 int main(int argc, char* argv[]) {
+    // SIGINT/SIGTERM : les algorithmes s'arrêtent et la meilleure coloration est conservée
+    installInterruptHandler();
     try {
         std::string filename;
         int k = -1;  // Ne pas initialiser avec une valeur par défaut
+        // Paramètres des algorithmes
+        SolverOptions options;
+        // Descente automatique sur k (k devient facultatif et sert de valeur d'arrêt)
+        bool descent = false;
+        // Retrait des noeuds de degré inférieur à k avant la recherche
+        bool peel = false;
+        // Utilisation du cache binaire du graphe
+        bool useCache = false;
+        // Fichier de rapport JSON (une ligne par exécution)
+        std::string reportFile;
+        // Fichier CSV des échantillons (temps, température, coût) de la trajectoire
+        std::string traceFile;
+        // Fichier de la coloration finale
+        std::string outputFile;
+        // Reprise du recuit simulé à partir du fichier --checkpoint
+        bool resume = false;
+        // Mode manifeste : fichier des travaux et nombre de travaux simultanés
+        std::string manifestFile;
+        int numJobs = 0; // 0 : les coeurs sont répartis entre les travaux
+        // Limite de la recherche exacte de clique (borne inférieure), 0 pour l'heuristique seule
+        long long cliqueNodes = 100000;
+        // Renumérotation des noeuds après le chargement ("rcm", "degree" ou "bfs"), vide si aucune
+        std::string ordering;
         // Recherche de l'argument --file
         for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
             // Recherche de l'argument --file
-            if (std::string(argv[i]) == "--file" && i + 1 < argc) {
+            if (arg == "--file" && i + 1 < argc) {
                 filename = argv[i + 1];
             }
             // Recherche de l'argument --k
-            if (std::string(argv[i]) == "--k" && i + 1 < argc) {
+            if (arg == "--k" && i + 1 < argc) {
                 k = std::stoi(argv[i + 1]);
             }
+            // Recherche des paramètres du recuit simulé
+            if (arg == "--initTemp" && i + 1 < argc) {
+                options.initTemp = std::stod(argv[i + 1]);
+            }
+            if (arg == "--coolingRate" && i + 1 < argc) {
+                options.coolingRate = std::stod(argv[i + 1]);
+            }
+            if (arg == "--maxIter" && i + 1 < argc) {
+                options.maxIter = std::stoll(argv[i + 1]);
+            }
+            if (arg == "--nbChanges" && i + 1 < argc) {
+                options.nbChanges = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--kempe" && i + 1 < argc) {
+                options.kempeRate = std::stod(argv[i + 1]);
+            }
+            if (arg == "--timeLimit" && i + 1 < argc) {
+                options.timeLimit = std::stoi(argv[i + 1]);
+            }
+            // Recherche de l'algorithme et de ses paramètres
+            if (arg == "--solver" && i + 1 < argc) {
+                options.solver = argv[i + 1];
+            }
+            if (arg == "--tabuIter" && i + 1 < argc) {
+                options.tabuIter = std::stoll(argv[i + 1]);
+            }
+            if (arg == "--threads" && i + 1 < argc) {
+                options.numThreads = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--replicas" && i + 1 < argc) {
+                options.numReplicas = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--tMin" && i + 1 < argc) {
+                options.minTemp = std::stod(argv[i + 1]);
+            }
+            if (arg == "--tMax" && i + 1 < argc) {
+                options.maxTemp = std::stod(argv[i + 1]);
+            }
+            if (arg == "--exchangeInterval" && i + 1 < argc) {
+                options.exchangeInterval = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--conflictSampling") {
+                options.conflictSampling = true;
+            }
+            if (arg == "--rng" && i + 1 < argc) {
+                options.engine = argv[i + 1];
+            }
+            if (arg == "--cache") {
+                useCache = true;
+            }
+            if (arg == "--seed" && i + 1 < argc) {
+                options.seed = static_cast<unsigned>(std::stoul(argv[i + 1]));
+            }
+            if (arg == "--report" && i + 1 < argc) {
+                reportFile = argv[i + 1];
+            }
+            if (arg == "--trace" && i + 1 < argc) {
+                traceFile = argv[i + 1];
+            }
+            if (arg == "--output" && i + 1 < argc) {
+                outputFile = argv[i + 1];
+            }
+            if (arg == "--target" && i + 1 < argc) {
+                options.targetConflicts = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--checkpoint" && i + 1 < argc) {
+                options.checkpointFile = argv[i + 1];
+            }
+            if (arg == "--checkpointPeriod" && i + 1 < argc) {
+                options.checkpointPeriod = std::stod(argv[i + 1]);
+            }
+            if (arg == "--resume") {
+                resume = true;
+            }
+            if (arg == "--manifest" && i + 1 < argc) {
+                manifestFile = argv[i + 1];
+            }
+            if (arg == "--jobs" && i + 1 < argc) {
+                numJobs = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--cliqueNodes" && i + 1 < argc) {
+                cliqueNodes = std::stoll(argv[i + 1]);
+            }
+            if (arg == "--descent") {
+                descent = true;
+            }
+            if (arg == "--peel") {
+                peel = true;
+            }
+            if (arg == "--reorder" && i + 1 < argc) {
+                ordering = argv[i + 1] == std::string("none") ? "" : argv[i + 1];
+            }
+            if (arg == "--init" && i + 1 < argc) {
+                options.init = argv[i + 1];
+            }
+            if (arg == "--population" && i + 1 < argc) {
+                options.populationSize = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--childIter" && i + 1 < argc) {
+                options.childIter = std::stoll(argv[i + 1]);
+            }
         }
 
-        if (filename.empty() || k == -1) {
-            std::cerr << "Utilisation : " << argv[0] << " --file <nom_du_fichier> --k <valeur_de_k>" << std::endl;
+        if (manifestFile.empty() && (filename.empty() || (k == -1 && !descent))) {
+            std::cerr << "Utilisation : " << argv[0] << " --file <nom_du_fichier> --k <valeur_de_k>"
+                      << " [--solver pipeline|tabucol|partialcol|tempering|hybrid] [--initTemp <t>] [--coolingRate <r>]"
+                      << " [--maxIter <n>]"
+                      << " [--nbChanges <n>] [--tabuIter <n>] [--timeLimit <s>] [--threads <n>] [--replicas <n>]"
+                      << " [--tMin <t>] [--tMax <t>] [--exchangeInterval <n>] [--conflictSampling] [--cache]"
+                      << " [--seed <n>] [--report <fichier>] [--trace <fichier>] [--descent] [--population <n>]"
+                      << " [--childIter <n>] [--init greedy|dsatur] [--peel] [--rng xoshiro|mt19937]"
+                      << " [--target <n>] [--output <fichier>] [--checkpoint <fichier>] [--checkpointPeriod <s>]"
+                      << " [--resume] [--cliqueNodes <n>] [--kempe <p>] [--reorder none|rcm|degree|bfs]" << std::endl;
+            std::cerr << "       " << argv[0] << " --manifest <fichier> [--jobs <n>] [options des algorithmes]"
+                      << std::endl;
             return 1;
         }
+        if (std::find(solverNames().begin(), solverNames().end(), options.solver) == solverNames().end()) {
+            std::cerr << "Algorithme inconnu : " << options.solver << std::endl;
+            return 1;
+        }
+        if (!ordering.empty()
+            && std::find(orderingNames().begin(), orderingNames().end(), ordering) == orderingNames().end()) {
+            std::cerr << "Renumerotation inconnue : " << ordering << std::endl;
+            return 1;
+        }
+        if (peel && descent) {
+            std::cerr << "L'option --peel depend de k et ne peut pas etre combinee avec --descent." << std::endl;
+            return 1;
+        }
+        if (options.init != "greedy" && options.init != "dsatur") {
+            std::cerr << "Heuristique initiale inconnue : " << options.init << std::endl;
+            return 1;
+        }
+        if (options.engine != "xoshiro" && options.engine != "mt19937") {
+            std::cerr << "Generateur aleatoire inconnu : " << options.engine << std::endl;
+            return 1;
+        }
+        if (!(options.kempeRate >= 0 && options.kempeRate <= 1)) {
+            std::cerr << "La probabilite des chaines de Kempe doit etre dans [0, 1]." << std::endl;
+            return 1;
+        }
+        if (options.targetConflicts < 0) {
+            std::cerr << "Le nombre de conflits cible doit etre positif ou nul." << std::endl;
+            return 1;
+        }
+        if (resume && options.checkpointFile.empty()) {
+            std::cerr << "L'option --resume necessite --checkpoint <fichier>." << std::endl;
+            return 1;
+        }
+        if (!options.checkpointFile.empty()
+            && (options.solver != "pipeline" || options.numThreads != 1 || descent)) {
+            std::cerr << "Les points de reprise ne concernent que le recuit simule a une trajectoire (--solver"
+                      << " pipeline, --threads 1, sans --descent)." << std::endl;
+            return 1;
+        }
+        if (!(options.checkpointPeriod > 0)) {
+            std::cerr << "La periode des points de reprise doit etre strictement positive." << std::endl;
+            return 1;
+        }
+        if (!manifestFile.empty()) {
+            if (descent || peel || !options.checkpointFile.empty() || !outputFile.empty() || !reportFile.empty()
+                || !traceFile.empty()) {
+                std::cerr << "Le mode manifeste n'est pas compatible avec --descent, --peel, --checkpoint, --output,"
+                          << " --report et --trace." << std::endl;
+                return 1;
+            }
+            return runManifest(manifestFile, options, numJobs, useCache, cliqueNodes, ordering) > 0 ? 1 : 0;
+        }
+        // Point de reprise : la graine d'origine est conservée pour que la suite de la recherche soit identique
+        std::unique_ptr<AnnealingCheckpoint> checkpoint;
+        if (resume) {
+            checkpoint = std::make_unique<AnnealingCheckpoint>(readCheckpoint(options.checkpointFile));
+            options.seed = static_cast<unsigned>(checkpoint->seed);
+            options.resume = checkpoint.get();
+            std::cout << "Reprise du recuit a l'iteration " << checkpoint->iteration << " (graine " << options.seed
+                      << ", meilleur cout " << checkpoint->bestCost << ")" << std::endl;
+        }
 
         // Lecture du graphe depuis le fichier spécifié
-        Graph graph = readGraphFromFile(filename);
-
-        // Utilisation de l'heuristique et colorier le graphe avec k couleur
-        greedyColoring(graph, k);
-
-        // Calcul du conflit dans le graphe colorié
-        std::cout << "Dans le graphe il y a : " << graph.countConflicts() << " conflit(s) en utilisant l'heuristique"
+        auto start_time_load = std::chrono::high_resolution_clock::now();
+        Graph graph = readGraphFromFile(filename, useCache);
+        auto end_time_load = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double> duration_load = std::chrono::duration_cast<std::chrono::duration<double>>(
+                end_time_load - start_time_load);
+        std::cout << "Nombre de noeud: " << graph.getNumNodes() << ", Nombre d'arrete: " << graph.getNumEdges()
                   << std::endl;
+        std::cout << "Temps de chargement du graphe : " << duration_load.count() << " secondes" << std::endl;
+        if (!options.checkpointFile.empty()) {
+            // Un point de reprise n'est valable que pour le même fichier et la même renumérotation
+            sourceStamp(filename, options.graphSource.size, options.graphSource.time);
+            if (!ordering.empty()) {
+                options.graphSource.ordering = ordering;
+            }
+        }
 
-        // Utilisation du recuit simulé
-        auto start_time = std::chrono::high_resolution_clock::now();
-        Graph annealing = simulatedAnnealing(graph, k, 1000, 0.995, 75000, 1, 60);
-        auto end_time = std::chrono::high_resolution_clock::now();
+        // Mesures de la recherche, relatives à la fin du chargement
+        auto start_time_solve = std::chrono::high_resolution_clock::now();
+        SearchStats stats;
+        int greedyConflicts;
+        int bestConflicts;
+
+        // Renumérotation des noeuds pour la localité mémoire, la coloration finale est ramenée aux ID d'origine
+        Reordering reordering;
+        Graph loadedGraph;
+        AdjacencyLocality locality = adjacencyLocality(graph);
+        if (!ordering.empty()) {
+            AdjacencyLocality before = locality;
+            reordering = reorderGraph(graph, ordering);
+            loadedGraph = std::move(graph);
+            graph = std::move(reordering.graph);
+            locality = adjacencyLocality(graph);
+            double reorderTime = std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start_time_solve).count();
+            stats.phases.emplace_back("reorder", reorderTime);
+            std::cout << "Renumerotation (" << ordering << ") : ecart moyen entre voisins " << before.meanGap
+                      << " -> " << locality.meanGap << ", largeur de bande " << before.bandwidth << " -> "
+                      << locality.bandwidth << " (" << reorderTime << " secondes)" << std::endl;
+        }
 
-        // Calculez la durée d'exécution en secondes
-        std::chrono::duration<double> duration = std::chrono::duration_cast<std::chrono::duration<double>>(
-                end_time - start_time);
-        std::cout << "Temps d'execution un recuit simulee : " << duration.count() << " secondes" << std::endl;
+        // Borne inférieure du nombre chromatique : taille d'une grande clique
+        auto start_time_clique = std::chrono::high_resolution_clock::now();
+        CliqueBound bound = cliqueLowerBound(graph, cliqueNodes);
+        double cliqueTime = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start_time_clique).count();
+        stats.phases.emplace_back("clique", cliqueTime);
+        std::cout << "Borne inferieure (clique) : " << bound.lowerBound() << " couleur(s), "
+                  << (bound.exact ? "clique maximum" : "clique heuristique") << " (" << bound.nodes
+                  << " noeud(s) explore(s), " << cliqueTime << " secondes)" << std::endl;
+        // Sous la borne, aucune coloration légale n'existe : la recherche est inutile
+        bool belowBound = !descent && k < bound.lowerBound();
+        if (belowBound) {
+            std::cout << "Attention : k = " << k << " est inferieur a la borne, aucune coloration legale n'existe :"
+                      << " la coloration initiale est conservee sans recherche" << std::endl;
+        }
 
-        std::cout << "Dans le graphe apres recuit il y a : " << annealing.countConflicts() << " conflit(s)"
-                  << std::endl;
+        if (descent) {
+            // Descente sur k à partir de la coloration gloutonne
+            std::vector<DescentStep> steps;
+            k = kDescent(graph, k, bound.lowerBound(), options, stats, start_time_solve, steps);
+            greedyConflicts = 0;
+            bestConflicts = graph.countConflicts();
+
+            std::cout << "k\tdepart\tconflits\titerations\ttemps (s)" << std::endl;
+            for (const DescentStep& step : steps) {
+                std::cout << step.k << "\t" << step.startConflicts << "\t" << step.conflicts << "\t"
+                          << step.iterations << "\t" << step.seconds << std::endl;
+            }
+            std::cout << "Plus petit k trouve : " << k << std::endl;
+        } else {
+            // Réduction : retrait des noeuds de degré inférieur à k, seul le noyau est colorié par la recherche
+            Reduction reduction;
+            Graph original;
+            if (peel) {
+                auto start_time_peel = std::chrono::high_resolution_clock::now();
+                reduction = peelLowDegree(graph, k);
+                double peelTime = std::chrono::duration<double>(
+                        std::chrono::high_resolution_clock::now() - start_time_peel).count();
+                stats.phases.emplace_back("peel", peelTime);
+                std::cout << "Reduction : " << reduction.removed.size() << " noeud(s) retire(s) sur "
+                          << graph.getNumNodes() << " (" << 100.0 * static_cast<double>(reduction.removed.size())
+                                                            / std::max(1, graph.getNumNodes())
+                          << " %), noyau de " << reduction.core.getNumNodes() << " noeud(s) et "
+                          << reduction.core.getNumEdges() << " arete(s) sur " << graph.getNumEdges() << std::endl;
+                original = std::move(graph);
+                graph = reduction.core;
+            }
 
-        // Utilisation de la recherche local
-        auto start_time_local = std::chrono::high_resolution_clock::now();
-        localResearch(annealing, k, 500000);
-        auto end_time_local = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double> duration_local = std::chrono::duration_cast<std::chrono::duration<double>>(
-                end_time_local - start_time_local);
-        std::cout << "Temps d'execution de la recherche local : " << duration_local.count() << " secondes" << std::endl;
+            // Utilisation de l'heuristique et colorier le graphe avec k couleur
+            auto start_time_init = std::chrono::high_resolution_clock::now();
+            initialColoring(graph, k, options);
+            greedyConflicts = graph.countConflicts();
+            auto end_time_init = std::chrono::high_resolution_clock::now();
+            stats.recordBest(std::chrono::duration<double>(end_time_init - start_time_solve).count(), greedyConflicts);
+            stats.phases.emplace_back(options.init, std::chrono::duration<double>(
+                    end_time_init - start_time_init).count());
+
+            // Calcul du conflit dans le graphe colorié
+            std::cout << "Dans le graphe il y a : " << greedyConflicts << " conflit(s) en utilisant l'heuristique"
+                      << std::endl;
+
+            bestConflicts = graph.getNumNodes() > 0 && !belowBound
+                            ? runSolver(graph, k, options, stats, start_time_solve, &std::cout)
+                            : greedyConflicts;
+
+            if (peel) {
+                // Réinsertion des noeuds retirés dans l'ordre inverse du retrait
+                reinsertPeeled(original, reduction, graph.getColoring(), k);
+                graph = std::move(original);
+                bestConflicts = graph.countConflicts();
+                std::cout << "Dans le graphe complet il y a : " << bestConflicts << " conflit(s)" << std::endl;
+            }
+        }
+        if (!ordering.empty()) {
+            loadedGraph.setColoring(restoreOriginalColoring(reordering, graph.getColoring()));
+            graph = std::move(loadedGraph);
+        }
+        stats.elapsedSeconds = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start_time_solve).count();
+        bool interrupted = interruptToken().isCancelled();
+        if (interrupted) {
+            std::cout << "Recherche interrompue : meilleure coloration conservee avec " << bestConflicts
+                      << " conflit(s)" << std::endl;
+        }
 
-        std::cout << "Dans le graphe apres recuit et recherche local il y a : " << annealing.countConflicts() << " conflit(s)"
-                  << std::endl;
+        if (!outputFile.empty()) {
+            writeColoring(outputFile, graph);
+        }
+        if (!reportFile.empty()) {
+            writeRunReport(reportFile, filename, k, options.solver, options.seed, graph, duration_load.count(), bound,
+                           ordering.empty() ? "none" : ordering, locality, greedyConflicts, bestConflicts, stats,
+                           interrupted);
+        }
+        if (!traceFile.empty()) {
+            std::ofstream trace(traceFile);
+            if (!trace) {
+                throw std::runtime_error("Impossible d'ouvrir le fichier de trace : " + traceFile);
+            }
+            writeTraceCsv(trace, stats);
+        }
 
     } catch (const std::exception &e) {
         std::cerr << "Erreur : " << e.what() << std::endl;
         return 1;
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,112 @@
+/**
+ * @file Annealing.cpp
+ * @brief Implémente les briques non génériques du noyau du recuit simulé.
+ */
+
+#include "../include/Annealing.h"
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+/**
+ * @brief Constructeur de la classe Xoshiro256, l'état est initialisé par splitmix64 à partir de la graine.
+ * @param seed La graine du générateur.
+ */
+Xoshiro256::Xoshiro256(std::uint64_t seed) : state{} {
+    for (std::uint64_t& word : state) {
+        seed += 0x9E3779B97F4A7C15ull;
+        std::uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        word = z ^ (z >> 31);
+    }
+}
+
+/**
+ * @param delta La variation du nombre de conflits.
+ * @return exp(-delta / T) * 2^32.
+ */
+std::uint64_t AcceptanceTable::computeThreshold(int delta) const {
+    return static_cast<std::uint64_t>(std::exp(-delta / currentTemperature) * 4294967296.0);
+}
+
+/**
+ * @brief Constructeur de la classe GeometricCooling.
+ * @param initTemp La température initiale.
+ * @param rate Le coefficient de refroidissement.
+ * @param period Le nombre d'itérations entre deux refroidissements.
+ * @throw std::invalid_argument si initTemp <= 0, si rate n'est pas dans ]0, 1] ou si period < 1.
+ */
+GeometricCooling::GeometricCooling(double initTemp, double rate, int period)
+        : currentTemperature(initTemp), rate(rate), period(period) {
+    if (initTemp <= 0) {
+        throw std::invalid_argument("La température initiale doit être strictement positive.");
+    }
+    if (rate <= 0 || rate > 1) {
+        throw std::invalid_argument("Le coefficient de refroidissement doit être dans ]0, 1].");
+    }
+    if (period < 1) {
+        throw std::invalid_argument("La période de refroidissement doit être au moins 1.");
+    }
+}
+
+/**
+ * @brief Constructeur de la classe RecolorMove.
+ * @param k Le nombre de couleur utilisable, au moins 2.
+ * @param numChanges Le nombre de noeuds recoloriés par mouvement, au moins 1.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @throw std::invalid_argument si k < 2 ou si numChanges < 1.
+ */
+RecolorMove::RecolorMove(int k, int numChanges, bool conflictSampling)
+        : k(k), numChanges(numChanges), conflictSampling(conflictSampling) {
+    if (k < 2) {
+        throw std::invalid_argument("Le nombre de couleurs doit être au moins 2.");
+    }
+    if (numChanges < 1) {
+        throw std::invalid_argument("Le nombre de changements doit être au moins 1.");
+    }
+    undoLog.reserve(numChanges);
+}
+
+/**
+ * @brief Constructeur de la classe KempeMove.
+ * @param k Le nombre de couleur utilisable, au moins 2.
+ * @param numNodes Le nombre de noeuds du graphe.
+ * @param numChanges Le nombre de noeuds recoloriés par mouvement de recoloration, au moins 1.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param kempeRate La probabilité d'un échange de chaîne de Kempe, dans [0, 1].
+ * @throw std::invalid_argument si k < 2, si numChanges < 1 ou si kempeRate n'est pas dans [0, 1].
+ */
+KempeMove::KempeMove(int k, int numNodes, int numChanges, bool conflictSampling, double kempeRate)
+        : recolor(k, numChanges, conflictSampling), chain(numNodes), k(k), conflictSampling(conflictSampling),
+          kempeThreshold(static_cast<std::uint64_t>(kempeRate * 4294967296.0)) {
+    if (!(kempeRate >= 0 && kempeRate <= 1)) {
+        throw std::invalid_argument("La probabilité des chaînes de Kempe doit être dans [0, 1].");
+    }
+}
+
+/**
+ * @brief Écrit l'état du générateur sous forme textuelle, comme les générateurs de la bibliothèque standard.
+ * @param out Le flux de sortie.
+ * @param engine Le générateur.
+ * @return Le flux de sortie.
+ */
+std::ostream& operator<<(std::ostream& out, const Xoshiro256& engine) {
+    return out << engine.state[0] << ' ' << engine.state[1] << ' ' << engine.state[2] << ' ' << engine.state[3];
+}
+
+/**
+ * @brief Relit un état écrit par operator<<.
+ * @param in Le flux d'entrée.
+ * @param engine Le générateur, inchangé si la lecture échoue.
+ * @return Le flux d'entrée.
+ */
+std::istream& operator>>(std::istream& in, Xoshiro256& engine) {
+    std::uint64_t state[4];
+    if (in >> state[0] >> state[1] >> state[2] >> state[3]) {
+        std::copy(state, state + 4, engine.state);
+    }
+    return in;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file Checkpoint.cpp
+ * @brief Implémente le format binaire des points de reprise du recuit simulé et leur écriture en arrière-plan.
+ */
+
+#include "../include/Checkpoint.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    // Signature et version des points de reprise.
+    constexpr char CHECKPOINT_MAGIC[8] = {'K', 'C', 'O', 'L', 'C', 'K', 'P', 'T'};
+    constexpr std::uint32_t CHECKPOINT_VERSION = 4;
+
+    /**
+     * @struct CheckpointHeader
+     * @brief En-tête d'un point de reprise, suivi du nom du générateur, du nom de la renumérotation, de la coloration
+     * courante, de la meilleure coloration (numNodes entiers chacune) puis de l'état du flux aléatoire.
+     */
+    struct CheckpointHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::int32_t k;
+        std::int32_t numNodes;
+        std::int32_t numEdges;
+        std::int32_t bestCost;
+        std::uint64_t seed;
+        std::int64_t iteration;
+        std::int64_t indexBestSol;
+        std::int64_t indexLastChange;
+        double temperature;
+        std::int64_t acceptedMoves;
+        std::int64_t uphillMoves;
+        std::int64_t sourceSize;
+        std::int64_t sourceTime;
+        double initTemp;
+        double coolingRate;
+        double kempeRate;
+        std::int32_t nbChanges;
+        std::int32_t conflictSampling;
+        std::uint32_t engineSize;
+        std::uint32_t orderingSize;
+        std::uint32_t rngStateSize;
+    };
+}
+
+/**
+ * @brief Écrit un point de reprise dans un fichier binaire.
+ *
+ * Le fichier est d'abord écrit sous un nom temporaire puis renommé : en cas d'arrêt brutal pendant l'écriture, le
+ * point de reprise précédent reste intact.
+ *
+ * @param checkpoint Le point de reprise.
+ * @param filename Le nom du fichier.
+ * @throw std::runtime_error si le fichier ne peut pas être écrit.
+ */
+void writeCheckpoint(const AnnealingCheckpoint& checkpoint, const std::string& filename) {
+    if (checkpoint.bestColoring.size() != checkpoint.currentColoring.size()) {
+        throw std::runtime_error("Point de reprise incohérent : les colorations n'ont pas la même taille.");
+    }
+    CheckpointHeader header{};
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    header.version = CHECKPOINT_VERSION;
+    header.k = checkpoint.k;
+    header.numNodes = static_cast<std::int32_t>(checkpoint.currentColoring.size());
+    header.numEdges = checkpoint.numEdges;
+    header.bestCost = checkpoint.bestCost;
+    header.indexBestSol = checkpoint.indexBestSol;
+    header.indexLastChange = checkpoint.indexLastChange;
+    header.seed = checkpoint.seed;
+    header.iteration = checkpoint.iteration;
+    header.temperature = checkpoint.temperature;
+    header.acceptedMoves = checkpoint.acceptedMoves;
+    header.uphillMoves = checkpoint.uphillMoves;
+    header.sourceSize = checkpoint.source.size;
+    header.sourceTime = checkpoint.source.time;
+    header.initTemp = checkpoint.initTemp;
+    header.coolingRate = checkpoint.coolingRate;
+    header.kempeRate = checkpoint.kempeRate;
+    header.nbChanges = checkpoint.nbChanges;
+    header.conflictSampling = checkpoint.conflictSampling ? 1 : 0;
+    header.engineSize = static_cast<std::uint32_t>(checkpoint.engine.size());
+    header.orderingSize = static_cast<std::uint32_t>(checkpoint.source.ordering.size());
+    header.rngStateSize = static_cast<std::uint32_t>(checkpoint.rngState.size());
+
+    std::string tmpFile = filename + ".tmp";
+    {
+        std::ofstream out(tmpFile, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw std::runtime_error("Impossible d'écrire le point de reprise : " + tmpFile);
+        }
+        auto coloringBytes = static_cast<std::streamsize>(checkpoint.currentColoring.size() * sizeof(int));
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(checkpoint.engine.data(), static_cast<std::streamsize>(checkpoint.engine.size()));
+        out.write(checkpoint.source.ordering.data(), static_cast<std::streamsize>(checkpoint.source.ordering.size()));
+        out.write(reinterpret_cast<const char*>(checkpoint.currentColoring.data()), coloringBytes);
+        out.write(reinterpret_cast<const char*>(checkpoint.bestColoring.data()), coloringBytes);
+        out.write(checkpoint.rngState.data(), static_cast<std::streamsize>(checkpoint.rngState.size()));
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("Impossible d'écrire le point de reprise : " + tmpFile);
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpFile, filename, ec);
+    if (ec) {
+        std::filesystem::remove(tmpFile, ec);
+        throw std::runtime_error("Impossible de renommer le point de reprise : " + filename);
+    }
+}
+
+/**
+ * @brief Lit un point de reprise écrit par writeCheckpoint.
+ * @param filename Le nom du fichier.
+ * @return Le point de reprise.
+ * @throw std::runtime_error si le fichier ne peut pas être lu ou n'est pas un point de reprise valide.
+ */
+AnnealingCheckpoint readCheckpoint(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error("Impossible d'ouvrir le point de reprise : " + filename);
+    }
+    CheckpointHeader header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || std::memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0) {
+        throw std::runtime_error("Le fichier n'est pas un point de reprise : " + filename);
+    }
+    if (header.version != CHECKPOINT_VERSION) {
+        throw std::runtime_error("Version de point de reprise non supportée : " + filename);
+    }
+    if (header.numNodes < 0 || header.numEdges < 0 || header.k < 0 || header.iteration < 0
+        || !(header.temperature > 0)) {
+        throw std::runtime_error("Point de reprise corrompu : " + filename);
+    }
+
+    AnnealingCheckpoint checkpoint;
+    checkpoint.numEdges = header.numEdges;
+    checkpoint.source.size = header.sourceSize;
+    checkpoint.source.time = header.sourceTime;
+    checkpoint.k = header.k;
+    checkpoint.seed = header.seed;
+    checkpoint.iteration = header.iteration;
+    checkpoint.temperature = header.temperature;
+    checkpoint.bestCost = header.bestCost;
+    checkpoint.indexBestSol = header.indexBestSol;
+    checkpoint.indexLastChange = header.indexLastChange;
+    checkpoint.acceptedMoves = header.acceptedMoves;
+    checkpoint.uphillMoves = header.uphillMoves;
+    checkpoint.initTemp = header.initTemp;
+    checkpoint.coolingRate = header.coolingRate;
+    checkpoint.kempeRate = header.kempeRate;
+    checkpoint.nbChanges = header.nbChanges;
+    checkpoint.conflictSampling = header.conflictSampling != 0;
+    checkpoint.engine.resize(header.engineSize);
+    checkpoint.source.ordering.resize(header.orderingSize);
+    checkpoint.currentColoring.resize(header.numNodes);
+    checkpoint.bestColoring.resize(header.numNodes);
+    checkpoint.rngState.resize(header.rngStateSize);
+    auto coloringBytes = static_cast<std::streamsize>(checkpoint.currentColoring.size() * sizeof(int));
+    in.read(checkpoint.engine.data(), static_cast<std::streamsize>(checkpoint.engine.size()));
+    in.read(checkpoint.source.ordering.data(), static_cast<std::streamsize>(checkpoint.source.ordering.size()));
+    in.read(reinterpret_cast<char*>(checkpoint.currentColoring.data()), coloringBytes);
+    in.read(reinterpret_cast<char*>(checkpoint.bestColoring.data()), coloringBytes);
+    in.read(checkpoint.rngState.data(), static_cast<std::streamsize>(checkpoint.rngState.size()));
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) {
+        throw std::runtime_error("Point de reprise tronqué ou corrompu : " + filename);
+    }
+    return checkpoint;
+}
+
+/**
+ * @brief Constructeur de la classe CheckpointWriter, démarre le thread d'écriture.
+ * @param filename Le nom du fichier de reprise.
+ * @param periodSeconds Le temps minimum (en secondes) entre deux points de reprise.
+ * @param parameters Les paramètres de la trajectoire (graphe, k, graine, générateur et paramètres du recuit), recopiés
+ * dans chaque point de reprise ; les champs de l'état sont ignorés.
+ * @throw std::invalid_argument si periodSeconds <= 0.
+ */
+CheckpointWriter::CheckpointWriter(std::string filename, double periodSeconds, AnnealingCheckpoint parameters)
+        : filename(std::move(filename)), periodSeconds(periodSeconds), parameters(std::move(parameters)) {
+    if (!(periodSeconds > 0)) {
+        throw std::invalid_argument("La période des points de reprise doit être strictement positive.");
+    }
+    thread = std::thread(&CheckpointWriter::writeLoop, this);
+}
+
+/**
+ * @brief Destructeur de la classe CheckpointWriter, écrit le point de reprise en attente puis arrête le thread.
+ */
+CheckpointWriter::~CheckpointWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    thread.join();
+}
+
+/**
+ * @brief Confie un point de reprise au thread d'écriture, sans attendre son écriture.
+ * @param checkpoint L'état de la trajectoire, les paramètres (graphe, k, graine, générateur, recuit) sont complétés.
+ */
+void CheckpointWriter::submit(AnnealingCheckpoint checkpoint) {
+    checkpoint.numEdges = parameters.numEdges;
+    checkpoint.source = parameters.source;
+    checkpoint.k = parameters.k;
+    checkpoint.seed = parameters.seed;
+    checkpoint.engine = parameters.engine;
+    checkpoint.initTemp = parameters.initTemp;
+    checkpoint.coolingRate = parameters.coolingRate;
+    checkpoint.nbChanges = parameters.nbChanges;
+    checkpoint.kempeRate = parameters.kempeRate;
+    checkpoint.conflictSampling = parameters.conflictSampling;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = std::move(checkpoint);
+        hasPending = true;
+    }
+    changed.notify_all();
+}
+
+/**
+ * @brief Attend que le point de reprise en attente soit écrit.
+ */
+void CheckpointWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this]() { return !hasPending && !writing; });
+}
+
+/**
+ * @return Le temps minimum (en secondes) entre deux points de reprise.
+ */
+double CheckpointWriter::getPeriod() const {
+    return periodSeconds;
+}
+
+/**
+ * @return Le nombre de points de reprise écrits.
+ */
+long long CheckpointWriter::getWritten() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return written;
+}
+
+/**
+ * @brief Boucle du thread d'écriture : écrit le point de reprise en attente, jusqu'à l'arrêt demandé par le
+ * destructeur (le dernier point de reprise déposé est toujours écrit).
+ */
+void CheckpointWriter::writeLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        changed.wait(lock, [this]() { return hasPending || stopping; });
+        if (!hasPending) {
+            return;
+        }
+        AnnealingCheckpoint checkpoint = std::move(pending);
+        hasPending = false;
+        writing = true;
+        lock.unlock();
+        bool success = true;
+        try {
+            writeCheckpoint(checkpoint, filename);
+        } catch (const std::exception& e) {
+            // Une écriture manquée n'interrompt pas la recherche, la suivante sera tentée normalement
+            std::cerr << "Erreur : " << e.what() << std::endl;
+            success = false;
+        }
+        lock.lock();
+        writing = false;
+        if (success) {
+            written++;
+        }
+        changed.notify_all();
+    }
+}
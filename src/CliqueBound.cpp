@@ -0,0 +1,348 @@
+/**
+ * @file CliqueBound.cpp
+ * @brief Implémente la recherche d'une grande clique (heuristique gloutonne et recherche exacte bornée).
+ */
+
+#include "../include/CliqueBound.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+    /**
+     * @brief Indice du bit à 1 de poids le plus faible d'un mot non nul.
+     */
+    inline int lowestBit64(std::uint64_t x) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+
+    /**
+     * @brief Calcule le numéro de coeur de chaque noeud (algorithme de Batagelj et Zaversnik, en O(n + m)).
+     * @param graph Le graphe.
+     * @return core[v] : le plus grand c tel que v appartient à un sous-graphe dont tous les noeuds ont au moins c
+     * voisins.
+     */
+    std::vector<int> coreNumbers(const Graph& graph) {
+        int numNodes = graph.getNumNodes();
+        int maxDegree = 0;
+        std::vector<int> degree(numNodes);
+        for (int v = 0; v < numNodes; v++) {
+            degree[v] = graph.getDegree(v);
+            maxDegree = std::max(maxDegree, degree[v]);
+        }
+        // Tri des noeuds par degré (tri par dénombrement) : bucketStart[d] est la position du premier noeud de degré d
+        std::vector<int> bucketStart(maxDegree + 2, 0);
+        for (int v = 0; v < numNodes; v++) {
+            bucketStart[degree[v] + 1]++;
+        }
+        for (int d = 0; d <= maxDegree; d++) {
+            bucketStart[d + 1] += bucketStart[d];
+        }
+        std::vector<int> order(numNodes);
+        std::vector<int> position(numNodes);
+        std::vector<int> next(bucketStart.begin(), bucketStart.end() - 1);
+        for (int v = 0; v < numNodes; v++) {
+            position[v] = next[degree[v]]++;
+            order[position[v]] = v;
+        }
+        // Retrait des noeuds par degré croissant, le degré des voisins restants diminue en restant trié
+        for (int i = 0; i < numNodes; i++) {
+            int v = order[i];
+            for (int u : graph.getNeighbors(v)) {
+                if (degree[u] > degree[v]) {
+                    int first = order[bucketStart[degree[u]]];
+                    std::swap(order[position[u]], order[bucketStart[degree[u]]]);
+                    std::swap(position[u], position[first]);
+                    bucketStart[degree[u]]++;
+                    degree[u]--;
+                }
+            }
+        }
+        return degree;
+    }
+
+    /**
+     * @class ExactClique
+     * @brief Recherche exacte d'une clique maximum par séparation et évaluation (Tomita et Seki) : les candidats sont
+     * coloriés gloutonnement, une branche est coupée si la taille de la clique courante plus le nombre de couleurs
+     * des candidats restants ne dépasse pas la meilleure clique.
+     */
+    class ExactClique {
+    public:
+        /**
+         * @brief Constructeur de la classe ExactClique, construit la matrice d'adjacence de bits du sous-graphe.
+         * @param graph Le graphe.
+         * @param vertices Les noeuds du sous-graphe, par ordre de priorité décroissante.
+         * @param best La meilleure clique connue (ID du graphe).
+         * @param maxNodes Le nombre maximum de noeuds de l'arbre de recherche.
+         */
+        ExactClique(const Graph& graph, std::vector<int> vertices, std::vector<int> best, long long maxNodes)
+                : numNodes(static_cast<int>(vertices.size())), words((numNodes + 63) / 64),
+                  vertices(std::move(vertices)), best(std::move(best)), maxNodes(maxNodes) {
+            std::vector<int> local(graph.getNumNodes(), -1);
+            for (int i = 0; i < numNodes; i++) {
+                local[this->vertices[i]] = i;
+            }
+            adjacency.assign(static_cast<size_t>(numNodes) * words, 0);
+            for (int i = 0; i < numNodes; i++) {
+                for (int u : graph.getNeighbors(this->vertices[i])) {
+                    if (local[u] >= 0) {
+                        row(i)[local[u] / 64] |= std::uint64_t(1) << (local[u] % 64);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Lance la recherche.
+         * @return true si la recherche est complète (la meilleure clique est maximum).
+         */
+        bool run() {
+            if (numNodes == 0) {
+                return true;
+            }
+            Level& root = level(0);
+            root.candidates.assign(words, 0);
+            for (int i = 0; i < numNodes; i++) {
+                root.candidates[i / 64] |= std::uint64_t(1) << (i % 64);
+            }
+            expand(0);
+            return !aborted;
+        }
+
+        /**
+         * @return La meilleure clique trouvée (ID du graphe).
+         */
+        [[nodiscard]] const std::vector<int>& getBest() const {
+            return best;
+        }
+
+        /**
+         * @return Le nombre de noeuds de l'arbre de recherche.
+         */
+        [[nodiscard]] long long getNodes() const {
+            return nodes;
+        }
+
+    private:
+        /**
+         * @struct Level
+         * @brief Tampons d'un niveau de l'arbre de recherche, réutilisés d'un noeud de l'arbre à l'autre.
+         */
+        struct Level {
+            std::vector<std::uint64_t> candidates; // Les candidats.
+            std::vector<std::uint64_t> uncolored; // Les candidats pas encore coloriés.
+            std::vector<std::uint64_t> available; // Les candidats pouvant recevoir la couleur courante.
+            std::vector<int> order; // Les candidats par couleur croissante.
+            std::vector<int> bound; // bound[i] : la couleur de order[i].
+        };
+
+        /**
+         * @param i Un noeud du sous-graphe.
+         * @return La ligne de la matrice d'adjacence du noeud.
+         */
+        std::uint64_t* row(int i) {
+            return &adjacency[static_cast<size_t>(i) * words];
+        }
+
+        /**
+         * @param depth La profondeur.
+         * @return Les tampons du niveau, créés au premier accès (leur adresse ne change plus ensuite).
+         */
+        Level& level(size_t depth) {
+            while (levels.size() <= depth) {
+                levels.push_back(std::make_unique<Level>());
+            }
+            return *levels[depth];
+        }
+
+        /**
+         * @brief Colorie gloutonnement les candidats d'un niveau : order et bound sont remplis par couleur croissante.
+         * @param current Le niveau.
+         */
+        void colorSort(Level& current) {
+            current.order.clear();
+            current.bound.clear();
+            current.uncolored = current.candidates;
+            int color = 0;
+            for (int w = 0; w < words; w++) {
+                while (current.uncolored[w] != 0) {
+                    color++;
+                    current.available = current.uncolored;
+                    for (int a = w; a < words; a++) {
+                        while (current.available[a] != 0) {
+                            int v = a * 64 + lowestBit64(current.available[a]);
+                            current.available[a] &= current.available[a] - 1;
+                            current.uncolored[a] &= ~(std::uint64_t(1) << (v % 64));
+                            const std::uint64_t* neighbors = row(v);
+                            for (int b = a; b < words; b++) {
+                                current.available[b] &= ~neighbors[b];
+                            }
+                            current.order.push_back(v);
+                            current.bound.push_back(color);
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Explore les cliques qui étendent la clique courante avec les candidats du niveau depth.
+         * @param depth La profondeur (la taille de la clique courante).
+         */
+        void expand(size_t depth) {
+            if (++nodes > maxNodes) {
+                aborted = true;
+                return;
+            }
+            Level& current = level(depth);
+            Level& child = level(depth + 1);
+            colorSort(current);
+            for (size_t i = current.order.size(); i-- > 0;) {
+                if (clique.size() + current.bound[i] <= best.size()) {
+                    return;
+                }
+                int v = current.order[i];
+                clique.push_back(v);
+                const std::uint64_t* neighbors = row(v);
+                bool empty = true;
+                child.candidates.resize(words);
+                for (int w = 0; w < words; w++) {
+                    child.candidates[w] = current.candidates[w] & neighbors[w];
+                    empty = empty && child.candidates[w] == 0;
+                }
+                if (empty) {
+                    if (clique.size() > best.size()) {
+                        best.clear();
+                        for (int u : clique) {
+                            best.push_back(vertices[u]);
+                        }
+                    }
+                } else {
+                    expand(depth + 1);
+                }
+                clique.pop_back();
+                if (aborted) {
+                    return;
+                }
+                current.candidates[v / 64] &= ~(std::uint64_t(1) << (v % 64));
+            }
+        }
+
+        int numNodes; // Le nombre de noeuds du sous-graphe.
+        int words; // Le nombre de mots de 64 bits par ligne de la matrice.
+        std::vector<int> vertices; // vertices[i] : l'ID dans le graphe du noeud i du sous-graphe.
+        std::vector<std::uint64_t> adjacency; // La matrice d'adjacence de bits du sous-graphe.
+        std::vector<std::unique_ptr<Level>> levels; // Les tampons de chaque niveau.
+        std::vector<int> clique; // La clique courante (noeuds du sous-graphe).
+        std::vector<int> best; // La meilleure clique (ID du graphe).
+        long long maxNodes; // Le nombre maximum de noeuds de l'arbre de recherche.
+        long long nodes = 0; // Le nombre de noeuds de l'arbre de recherche explorés.
+        bool aborted = false; // true si la limite de noeuds a été atteinte.
+    };
+}
+
+/**
+ * @brief Cherche une grande clique par une heuristique gloutonne.
+ *
+ * Depuis chaque noeud (par degré décroissant), la clique est étendue avec les voisins de plus grand degré adjacents
+ * à tous ses noeuds. Les noeuds de degré trop faible pour améliorer la meilleure clique sont ignorés.
+ *
+ * @param graph Le graphe.
+ * @return La plus grande clique trouvée.
+ */
+std::vector<int> greedyClique(const Graph& graph) {
+    int numNodes = graph.getNumNodes();
+    std::vector<int> byDegree(numNodes);
+    for (int v = 0; v < numNodes; v++) {
+        byDegree[v] = v;
+    }
+    auto higherDegree = [&graph](int a, int b) {
+        return graph.getDegree(a) > graph.getDegree(b) || (graph.getDegree(a) == graph.getDegree(b) && a < b);
+    };
+    std::sort(byDegree.begin(), byDegree.end(), higherDegree);
+
+    std::vector<int> best;
+    std::vector<int> clique;
+    std::vector<int> candidates;
+    // adjacentCount[u] : le nombre de noeuds de la clique courante voisins de u
+    std::vector<int> adjacentCount(numNodes, 0);
+    for (int start : byDegree) {
+        if (graph.getDegree(start) + 1 <= static_cast<int>(best.size())) {
+            break; // Les noeuds suivants ont un degré encore plus faible
+        }
+        candidates.assign(graph.getNeighbors(start).begin(), graph.getNeighbors(start).end());
+        std::sort(candidates.begin(), candidates.end(), higherDegree);
+        clique.assign(1, start);
+        for (int u : graph.getNeighbors(start)) {
+            adjacentCount[u]++;
+        }
+        for (int u : candidates) {
+            if (adjacentCount[u] == static_cast<int>(clique.size())) {
+                clique.push_back(u);
+                for (int w : graph.getNeighbors(u)) {
+                    adjacentCount[w]++;
+                }
+            }
+        }
+        if (clique.size() > best.size()) {
+            best = clique;
+        }
+        for (int v : clique) {
+            for (int w : graph.getNeighbors(v)) {
+                adjacentCount[w] = 0;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Calcule une borne inférieure du nombre chromatique.
+ *
+ * La clique de l'heuristique gloutonne est améliorée par une recherche exacte (séparation et évaluation, borne par
+ * coloration gloutonne, ensembles de bits) limitée à maxNodes noeuds de l'arbre de recherche. Seuls les noeuds dont
+ * le numéro de coeur (dégénérescence) est au moins la taille de la clique courante peuvent l'améliorer : la
+ * recherche exacte porte sur ce sous-graphe, et n'est pas lancée s'il dépasse CliqueBound::MAX_EXACT_NODES noeuds.
+ *
+ * @param graph Le graphe.
+ * @param maxNodes Le nombre maximum de noeuds de l'arbre de la recherche exacte, 0 pour l'heuristique seule.
+ * @return La plus grande clique trouvée et si elle est prouvée maximum.
+ */
+CliqueBound cliqueLowerBound(const Graph& graph, long long maxNodes) {
+    CliqueBound bound;
+    bound.clique = greedyClique(graph);
+    if (maxNodes <= 0) {
+        return bound;
+    }
+
+    // Une clique de taille s + 1 ne contient que des noeuds de numéro de coeur au moins s
+    std::vector<int> core = coreNumbers(graph);
+    std::vector<int> vertices;
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        if (core[v] >= bound.lowerBound()) {
+            vertices.push_back(v);
+        }
+    }
+    if (static_cast<int>(vertices.size()) > CliqueBound::MAX_EXACT_NODES) {
+        return bound;
+    }
+    std::sort(vertices.begin(), vertices.end(), [&](int a, int b) {
+        return core[a] > core[b] || (core[a] == core[b] && graph.getDegree(a) > graph.getDegree(b));
+    });
+    ExactClique search(graph, std::move(vertices), bound.clique, maxNodes);
+    bound.exact = search.run();
+    bound.clique = search.getBest();
+    bound.nodes = search.getNodes();
+    return bound;
+}
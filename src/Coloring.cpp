@@ -0,0 +1,261 @@
+/**
+ * @file Coloring.cpp
+ * @brief Implémente les heuristiques constructives de coloration et la suppression d'une classe de couleur.
+ */
+
+#include "../include/Coloring.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Colorie le graphe avec un algorithme glouton en utilisant au plus k couleurs.
+ *
+ * @param graph Le graphe à colorier.
+ * @param k Le nombre maximal de couleurs à utiliser.
+ */
+void greedyColoring(Graph& graph, int k) {
+
+    int numNodes = graph.getNumNodes();
+    bool dense = graph.isDense();
+
+    // Créez un vecteur d'indices pour trier les noeuds
+    std::vector<int> nodeIndices(numNodes);
+    for (int i = 0; i < numNodes; i++) {
+        nodeIndices[i] = i;
+    }
+
+    // Triez les indices en fonction du degré des noeuds (nombre de voisins)
+    std::sort(nodeIndices.begin(), nodeIndices.end(), [&graph](int a, int b) {
+        return graph.getDegree(a) > graph.getDegree(b);
+    });
+
+    // Toutes les couleurs sont remises à -1 (non attribuées)
+    graph.clearColoring();
+    // Couleurs des voisins du noeud courant, tampon réutilisé d'un noeud à l'autre
+    std::vector<bool> neighborColors(k, false);
+
+    for (int i : nodeIndices) {
+        int chosenColor = -1;
+
+        if (dense) {
+            // Représentation dense : une couleur est libre si sa classe ne contient aucun voisin
+            for (int color = 0; color < k; color++) {
+                if (graph.countNeighborsWithColor(i, color) == 0) {
+                    chosenColor = color;
+                    break;
+                }
+            }
+        } else {
+            std::fill(neighborColors.begin(), neighborColors.end(), false);
+
+            // Parcourez les voisins et marquez leurs couleurs comme utilisées
+            for (int neighborID : graph.getNeighbors(i)) {
+                int neighborColor = graph.getColor(neighborID);
+                if (neighborColor >= 0) {
+                    neighborColors[neighborColor] = true;
+                }
+            }
+
+            // Attribuez la première couleur non utilisée
+            for (int color = 0; color < k; color++) {
+                if (!neighborColors[color]) {
+                    chosenColor = color;
+                    break;
+                }
+            }
+        }
+
+        if (chosenColor == -1) {
+            // Si aucune couleur non utilisée n'est trouvée, attribuez la couleur la moins utilisée parmi les voisins
+            int minNeighborCount = numNodes + 1;
+            for (int color = 0; color < k; color++) {
+                int neighborCount = graph.countNeighborsWithColor(i, color);
+                if (neighborCount < minNeighborCount) {
+                    chosenColor = color;
+                    minNeighborCount = neighborCount;
+                }
+            }
+        }
+        // Mettez à jour la couleur du noeud (conflictCount est maintenu de manière incrémentale)
+        graph.recolorNode(i, chosenColor);
+    }
+}
+
+/**
+ * @brief Colorie le graphe avec l'heuristique DSATUR en utilisant au plus k couleurs.
+ *
+ * À chaque étape, le noeud non colorié de plus grand degré de saturation (nombre de couleurs différentes parmi ses
+ * voisins) est colorié, les égalités étant départagées par le degré dans le sous-graphe non colorié. Les noeuds
+ * sont rangés dans une file à seaux indexée par la clé (saturation + 1) * (degré maximum + 1) + degré non colorié :
+ * les seaux sont des listes doublement chaînées, un noeud change donc de seau en O(1). Les couleurs du voisinage de
+ * chaque noeud forment un ensemble trié de paires (couleur, nombre de voisins) rangé dans deg(v) cases contiguës :
+ * la mémoire est en O(n + m) quel que soit k, et colorier un noeud coûte O(saturation) plus une insertion dans
+ * l'ensemble de chacun de ses voisins. Les noeuds dont les voisins utilisent déjà les k couleurs sont coloriés en
+ * dernier, avec la couleur la moins représentée parmi leurs voisins.
+ *
+ * @param graph Le graphe à colorier.
+ * @param k Le nombre maximal de couleurs à utiliser.
+ */
+void dsaturColoring(Graph& graph, int k) {
+    int numNodes = graph.getNumNodes();
+    graph.clearColoring();
+    if (numNodes == 0 || k < 1) {
+        return;
+    }
+
+    int maxDegree = 0;
+    for (int v = 0; v < numNodes; v++) {
+        maxDegree = std::max(maxDegree, graph.getDegree(v));
+    }
+    int stride = maxDegree + 1;
+
+    // Couleurs du voisinage de v : setColor et setCount[setStart[v], setStart[v] + saturation[v]), triés par couleur.
+    // Un noeud a au plus deg(v) couleurs voisines, les ensembles occupent donc 2m cases au total
+    std::vector<size_t> setStart(static_cast<size_t>(numNodes) + 1, 0);
+    for (int v = 0; v < numNodes; v++) {
+        setStart[v + 1] = setStart[v] + graph.getDegree(v);
+    }
+    std::vector<int> setColor(setStart[numNodes]);
+    std::vector<int> setCount(setStart[numNodes]);
+    std::vector<int> saturation(numNodes, 0);
+    std::vector<int> uncoloredDegree(numNodes);
+    std::vector<bool> colored(numNodes, false);
+
+    // File à seaux : listes doublement chaînées indexées par la clé. La saturation ne dépasse ni k ni le degré
+    int maxSaturation = std::min(k, stride);
+    std::vector<int> head(static_cast<size_t>(maxSaturation + 1) * stride, -1);
+    std::vector<int> next(numNodes, -1);
+    std::vector<int> prev(numNodes, -1);
+    std::vector<int> key(numNodes);
+    auto insert = [&](int v) {
+        int bucket = key[v];
+        prev[v] = -1;
+        next[v] = head[bucket];
+        if (head[bucket] >= 0) {
+            prev[head[bucket]] = v;
+        }
+        head[bucket] = v;
+    };
+    auto remove = [&](int v) {
+        if (prev[v] >= 0) {
+            next[prev[v]] = next[v];
+        } else {
+            head[key[v]] = next[v];
+        }
+        if (next[v] >= 0) {
+            prev[next[v]] = prev[v];
+        }
+    };
+
+    // Un noeud saturé (ses voisins utilisent déjà les k couleurs) sera en conflit quelle que soit sa couleur : il
+    // passe après tous les noeuds non saturés afin de ne pas leur imposer de conflits
+    auto dsaturKey = [&](int v) {
+        return saturation[v] < k ? (saturation[v] + 1) * stride + uncoloredDegree[v] : uncoloredDegree[v];
+    };
+
+    int maxKey = 0;
+    for (int v = numNodes - 1; v >= 0; v--) {
+        uncoloredDegree[v] = graph.getDegree(v);
+        key[v] = dsaturKey(v);
+        maxKey = std::max(maxKey, key[v]);
+        insert(v);
+    }
+
+    for (int step = 0; step < numNodes; step++) {
+        while (head[maxKey] < 0) {
+            maxKey--;
+        }
+        int v = head[maxKey];
+        remove(v);
+        colored[v] = true;
+
+        // Première couleur absente du voisinage (le premier trou de l'ensemble trié), sinon la moins représentée
+        const int* colors = &setColor[setStart[v]];
+        const int* counts = &setCount[setStart[v]];
+        int chosenColor = saturation[v];
+        for (int i = 0; i < saturation[v]; i++) {
+            if (colors[i] != i) {
+                chosenColor = i;
+                break;
+            }
+        }
+        if (chosenColor == k) {
+            chosenColor = static_cast<int>(std::min_element(counts, counts + k) - counts);
+        }
+        graph.recolorNode(v, chosenColor);
+
+        // Mise à jour des voisins non coloriés
+        for (int u : graph.getNeighbors(v)) {
+            if (colored[u]) {
+                continue;
+            }
+            remove(u);
+            int* colors = &setColor[setStart[u]];
+            int* counts = &setCount[setStart[u]];
+            int* last = colors + saturation[u];
+            int* position = std::lower_bound(colors, last, chosenColor);
+            if (position != last && *position == chosenColor) {
+                counts[position - colors]++;
+            } else {
+                // Insertion de la nouvelle couleur voisine à sa place dans l'ensemble trié
+                auto index = position - colors;
+                std::copy_backward(position, last, last + 1);
+                std::copy_backward(counts + index, counts + saturation[u], counts + saturation[u] + 1);
+                *position = chosenColor;
+                counts[index] = 1;
+                saturation[u]++;
+            }
+            uncoloredDegree[u]--;
+            key[u] = dsaturKey(u);
+            maxKey = std::max(maxKey, key[u]);
+            insert(u);
+        }
+    }
+}
+
+/**
+ * @brief Supprime une classe de couleur d'une coloration à k + 1 couleurs pour obtenir un point de départ à k
+ * couleurs.
+ *
+ * La plus petite classe est supprimée : chacun de ses noeuds reçoit la couleur restante qui provoque le moins de
+ * conflits, puis la couleur k est renumérotée avec l'indice de la classe supprimée.
+ *
+ * @param graph Le graphe colorié avec les couleurs [0, k].
+ * @param k Le nombre de couleurs après la suppression.
+ */
+void removeColorClass(Graph& graph, int k) {
+    std::vector<int> classSize(k + 1, 0);
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        classSize[graph.getColor(v)]++;
+    }
+    int removed = static_cast<int>(std::min_element(classSize.begin(), classSize.end()) - classSize.begin());
+
+    // Recoloration des noeuds de la classe supprimée
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        if (graph.getColor(v) != removed) {
+            continue;
+        }
+        int bestColor = -1;
+        int bestDelta = 0;
+        for (int color = 0; color <= k; color++) {
+            if (color == removed) {
+                continue;
+            }
+            int delta = graph.recolorDelta(v, color);
+            if (bestColor < 0 || delta < bestDelta) {
+                bestColor = color;
+                bestDelta = delta;
+            }
+        }
+        graph.recolorNode(v, bestColor);
+    }
+
+    // La classe supprimée est vide : la couleur k prend sa place
+    if (removed != k) {
+        for (int v = 0; v < graph.getNumNodes(); v++) {
+            if (graph.getColor(v) == k) {
+                graph.recolorNode(v, removed);
+            }
+        }
+    }
+}
@@ -7,6 +7,35 @@
 #include "../include/Graph.h"
 #include <random>
 #include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+    /**
+     * @brief Nombre de bits à 1 d'un mot (instruction POPCNT lorsque le processeur la fournit).
+     */
+    inline int popcount64(std::uint64_t x) {
+#if defined(_MSC_VER)
+        return static_cast<int>(__popcnt64(x));
+#else
+        return __builtin_popcountll(x);
+#endif
+    }
+
+    /**
+     * @brief Indice du bit à 1 de poids le plus faible d'un mot non nul.
+     */
+    inline int lowestBit64(std::uint64_t x) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+}
 
 /**
  * @brief Constructeur de la classe Graph.
@@ -18,28 +47,197 @@ Graph::Graph(int numNodes) : numNodes(numNodes) {
         throw std::invalid_argument("Le nombre de noeuds ne peut pas être négatif.");
     }
 
-    // Initialise conflictCount avec des zéros en fonction de la taille de numNodes
-    conflictCount.resize(numNodes, 0);
+    // Graphe sans arête, sans couleur ni conflit : tous les offsets sont nuls
+    setAdjacency(std::vector<int>(numNodes + 1, 0), {});
+}
+
+/**
+ * @brief Constructeur de la classe Graph à partir d'une liste d'arêtes.
+ * La table d'adjacence est construite une seule fois au format CSR (un tableau d'offsets et un tableau
+ * contigu de voisins).
+ * @param numNodes Le nombre de noeuds dans le graphe.
+ * @param edges La liste des arêtes (u, v) avec des ID dans [0, numNodes-1].
+ * @throw std::invalid_argument si numNodes est négatif ou si une arête est hors de la plage valide.
+ */
+Graph::Graph(int numNodes, const std::vector<std::pair<int, int>>& edges) : Graph(numNodes) {
+    std::vector<int> adjOffsets(numNodes + 1, 0);
+    // Premier passage : calcul des degrés
+    for (const auto& [u, v] : edges) {
+        if (u < 0 || u >= numNodes || v < 0 || v >= numNodes) {
+            throw std::invalid_argument("Les ID de noeuds sont en dehors de la plage valide.");
+        }
+        adjOffsets[u + 1]++;
+        adjOffsets[v + 1]++;
+    }
+    // Somme préfixe pour obtenir les offsets
     for (int i = 0; i < numNodes; i++) {
-        nodes.emplace_back(i);
+        adjOffsets[i + 1] += adjOffsets[i];
+    }
+    // Second passage : remplissage du tableau de voisins
+    std::vector<int> neighbors(adjOffsets[numNodes]);
+    std::vector<int> fill(adjOffsets.begin(), adjOffsets.end() - 1);
+    for (const auto& [u, v] : edges) {
+        neighbors[fill[u]++] = v;
+        neighbors[fill[v]++] = u;
+    }
+    setAdjacency(std::move(adjOffsets), std::move(neighbors));
+}
+
+/**
+ * @brief Constructeur de la classe Graph à partir d'une table d'adjacence CSR déjà construite.
+ * @param adjOffsets Les offsets CSR (taille numNodes + 1).
+ * @param adjacency Le tableau contigu des voisins.
+ * @throw std::invalid_argument si la table d'adjacence est incohérente.
+ */
+Graph::Graph(std::vector<int> adjOffsets, std::vector<int> adjacency)
+        : Graph(adjOffsets.empty() ? 0 : static_cast<int>(adjOffsets.size()) - 1) {
+    if (adjOffsets.empty() || adjOffsets.front() != 0
+        || adjOffsets.back() != static_cast<int>(adjacency.size())
+        || !std::is_sorted(adjOffsets.begin(), adjOffsets.end())) {
+        throw std::invalid_argument("Offsets de la table d'adjacence incohérents.");
+    }
+    for (int neighborID : adjacency) {
+        if (neighborID < 0 || neighborID >= numNodes) {
+            throw std::invalid_argument("Les ID de noeuds sont en dehors de la plage valide.");
+        }
     }
+    setAdjacency(std::move(adjOffsets), std::move(adjacency));
+}
+
+/**
+ * @brief Constructeur d'une coloration vide sur une topologie existante, qui est partagée et non copiée.
+ * @param topology La topologie.
+ * @throw std::invalid_argument si topology est nul.
+ */
+Graph::Graph(std::shared_ptr<const Topology> topology) : numNodes(0) {
+    if (topology == nullptr) {
+        throw std::invalid_argument("La topologie ne peut pas être nulle.");
+    }
+    numNodes = static_cast<int>(topology->offsets.size()) - 1;
+    setTopology(std::move(topology));
+}
+
+/**
+ * @brief Installe une nouvelle table d'adjacence CSR.
+ * Les voisins de chaque noeud sont triés, les doublons et les boucles (u, u) retirés : la liste de voisins et la
+ * matrice de bits décrivent alors les mêmes arêtes, et les conflits comptés sur l'une ou l'autre restent égaux.
+ * @param offsets Les offsets CSR (taille numNodes + 1).
+ * @param neighbors Le tableau contigu des voisins.
+ */
+void Graph::setAdjacency(std::vector<int> offsets, std::vector<int> neighbors) {
+    // Normalisation des lignes en place, les lignes sont compactées vers le début du tableau
+    int write = 0;
+    for (int i = 0; i < numNodes; i++) {
+        auto first = neighbors.begin() + offsets[i];
+        auto last = neighbors.begin() + offsets[i + 1];
+        std::sort(first, last);
+        offsets[i] = write;
+        int previous = -1;
+        for (auto it = first; it != last; ++it) {
+            if (*it != i && *it != previous) {
+                neighbors[write++] = *it;
+            }
+            previous = *it;
+        }
+    }
+    offsets[numNodes] = write;
+    neighbors.resize(write);
+
+    auto table = std::make_shared<Topology>();
+    table->offsets = std::move(offsets);
+    table->neighbors = std::move(neighbors);
+    // Construction de la matrice de bits si le graphe est assez dense
+    double maxEdges = static_cast<double>(numNodes) * (numNodes - 1);
+    if (numNodes > 1 && static_cast<double>(table->neighbors.size()) / maxEdges >= DENSE_THRESHOLD) {
+        table->words = (numNodes + 63) / 64;
+        table->bits.assign(static_cast<size_t>(numNodes) * table->words, 0);
+        for (int i = 0; i < numNodes; i++) {
+            std::uint64_t* row = &table->bits[static_cast<size_t>(i) * table->words];
+            for (int j = table->offsets[i]; j < table->offsets[i + 1]; j++) {
+                int neighborID = table->neighbors[j];
+                row[neighborID / 64] |= std::uint64_t(1) << (neighborID % 64);
+            }
+        }
+    }
+    setTopology(std::move(table));
+}
+
+/**
+ * @brief Installe une topologie existante et remet la coloration à zéro (aucun noeud colorié).
+ * @param table La topologie.
+ */
+void Graph::setTopology(std::shared_ptr<const Topology> table) {
+    offsetsData = table->offsets.data();
+    neighborsData = table->neighbors.data();
+    bitsData = table->bits.empty() ? nullptr : table->bits.data();
+    words = table->words;
+    topology = std::move(table);
+    colors.assign(numNodes, 0);
+    conflictCount.assign(numNodes, 0);
+    colorClasses.clear();
+    rebuildConflictingSet();
+}
 
+/**
+ * @return true si le graphe utilise la représentation dense (matrice de bits).
+ */
+bool Graph::isDense() const {
+    return bitsData != nullptr;
 }
 
+/**
+ * @brief Compte les voisins d'un noeud ayant une couleur donnée.
+ * En représentation dense, le calcul se fait par ET bit à bit et popcount sur la classe de couleur.
+ * @param id L'ID du noeud.
+ * @param color La couleur.
+ * @return Le nombre de voisins de couleur color.
+ */
+int Graph::countNeighborsWithColor(int id, int color) const {
+    if (bitsData != nullptr && color >= 0) {
+        if (static_cast<size_t>(color + 1) * words > colorClasses.size()) {
+            return 0; // Aucun noeud n'a encore reçu cette couleur
+        }
+        const std::uint64_t* row = bitsData + static_cast<size_t>(id) * words;
+        const std::uint64_t* colorClass = colorClasses.data() + static_cast<size_t>(color) * words;
+        int count = 0;
+        for (int w = 0; w < words; w++) {
+            count += popcount64(row[w] & colorClass[w]);
+        }
+        return count;
+    }
+    int count = 0;
+    int stored = color + 1;
+    for (int neighborID : getNeighbors(id)) {
+        if (colors[neighborID] == stored) {
+            count++;
+        }
+    }
+    return count;
+}
 
 /**
- * @brief Ajoute une arête entre deux noeuds du graphe.
- * @param u L'ID du premier noeud.
- * @param v L'ID du deuxième noeud.
- * @throw std::invalid_argument si u ou v sont en dehors de la plage [0, numNodes-1].
+ * @brief Agrandit les ensembles de bits des classes de couleur pour contenir la couleur donnée.
+ * @param color La couleur.
  */
-void Graph::addEdge(int u, int v) {
-    if (u < 0 || u >= numNodes || v < 0 || v >= numNodes) {
-        throw std::invalid_argument("Les ID de noeuds sont en dehors de la plage valide.");
+void Graph::ensureColorClass(int color) {
+    size_t needed = static_cast<size_t>(color + 1) * words;
+    if (colorClasses.size() < needed) {
+        colorClasses.resize(needed, 0);
     }
+}
 
-    nodes[u].addNeighbor(v);
-    nodes[v].addNeighbor(u);
+/**
+ * @brief Reconstruit les ensembles de bits des classes de couleur à partir des couleurs des noeuds.
+ */
+void Graph::rebuildColorClasses() {
+    colorClasses.assign(colorClasses.size(), 0);
+    for (int i = 0; i < numNodes; i++) {
+        int color = getColor(i);
+        if (color >= 0) {
+            ensureColorClass(color);
+            colorClasses[static_cast<size_t>(color) * words + i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+    }
 }
 
 /**
@@ -49,43 +247,122 @@ void Graph::addEdge(int u, int v) {
     return numNodes;
 }
 
+/**
+ * @return Le nombre d'arêtes dans le graphe.
+ */
+[[nodiscard]] int Graph::getNumEdges() const {
+    return static_cast<int>(topology->neighbors.size() / 2);
+}
+
+/**
+ * @return La topologie partagée du graphe.
+ */
+const std::shared_ptr<const Topology>& Graph::getTopology() const {
+    return topology;
+}
+
+
+/**
+ * @return Les offsets CSR de la table d'adjacence (taille numNodes + 1).
+ */
+const std::vector<int>& Graph::getAdjOffsets() const {
+    return topology->offsets;
+}
+
+/**
+ * @return Le tableau contigu des voisins de la table d'adjacence.
+ */
+const std::vector<int>& Graph::getAdjacency() const {
+    return topology->neighbors;
+}
 
 /**
  * @brief Obtient un noeud spécifique du graphe.
  * @param id L'ID du noeud à récupérer.
- * @return Une référence vers le noeud.
+ * @return Le noeud (ID et couleur courante).
  * @throw std::out_of_range si id est en dehors de la plage [0, numNodes-1].
  */
-[[nodiscard]] const Node& Graph::getNode(int id) const {
+[[nodiscard]] Node Graph::getNode(int id) const {
     if (id < 0 || id >= numNodes) {
         throw std::out_of_range("ID de noeud hors de la plage valide.");
     }
-    return nodes[id];
+    return {id, getColor(id)};
+}
+
+
+/**
+ * @brief Obtient un vecteur de conflit pour chaque noeud.
+ * Le vecteur n'est modifiable qu'à travers les méthodes du graphe, qui maintiennent l'ensemble des noeuds en
+ * conflit et le nombre total de conflits.
+ * @return Une référence constante vers le vecteur de conflits.
+ */
+const std::vector<int>& Graph::getConflictCount() const {
+    return conflictCount;
 }
 
 /**
- * @brief Obtient un vecteur de noeuds du graphe.
- * @return Une référence vers le vecteur de noeuds.
+ * @brief Obtient les noeuds actuellement en conflit (conflictCount > 0), dans un ordre quelconque.
+ * @return Une référence constante vers l'ensemble des noeuds en conflit.
  */
-std::vector<Node>& Graph::getNodes() {
-    return nodes;
+const std::vector<int>& Graph::getConflictingNodes() const {
+    return conflictingNodes;
 }
 
+/**
+ * @brief Tire uniformément un noeud parmi les noeuds en conflit, en O(1).
+ * @param rng Générateur de nombres aléatoires.
+ * @return L'ID du noeud tiré, -1 si aucun noeud n'est en conflit.
+ */
+int Graph::randomConflictingNode(std::mt19937& rng) const {
+    if (conflictingNodes.empty()) {
+        return -1;
+    }
+    std::uniform_int_distribution<int> distribution(0, static_cast<int>(conflictingNodes.size()) - 1);
+    return conflictingNodes[distribution(rng)];
+}
 
 /**
- * @brief Obtient un vecteur de conflit pour chaque noeud.
- * @return Une référence vers le vecteur de conflits.
+ * @brief Ajoute un conflit à un noeud et l'insère dans l'ensemble des noeuds en conflit si besoin.
+ * @param id L'ID du noeud.
  */
-std::vector<int>& Graph::getConflictCount() {
-    return conflictCount;
+inline void Graph::incrementConflict(int id) {
+    if (conflictCount[id]++ == 0) {
+        conflictingPos[id] = static_cast<int>(conflictingNodes.size());
+        conflictingNodes.push_back(id);
+    }
+    totalConflicts++;
+}
+
+/**
+ * @brief Retire un conflit à un noeud et le retire de l'ensemble des noeuds en conflit si besoin.
+ * @param id L'ID du noeud.
+ */
+inline void Graph::decrementConflict(int id) {
+    if (--conflictCount[id] == 0) {
+        // Retrait en O(1) : le dernier élément prend la place du noeud retiré
+        int last = conflictingNodes.back();
+        conflictingNodes[conflictingPos[id]] = last;
+        conflictingPos[last] = conflictingPos[id];
+        conflictingNodes.pop_back();
+        conflictingPos[id] = -1;
+    }
+    totalConflicts--;
 }
 
 /**
- * @brief Obtient un vecteur de noeuds du graphe (constante).
- * @return Une référence constante vers le vecteur de noeuds.
+ * @brief Reconstruit l'ensemble des noeuds en conflit et le nombre total de conflits à partir de conflictCount.
  */
-[[nodiscard]] const std::vector<Node>& Graph::getNodes() const {
-    return nodes;
+void Graph::rebuildConflictingSet() {
+    conflictingNodes.clear();
+    conflictingPos.assign(numNodes, -1);
+    totalConflicts = 0;
+    for (int i = 0; i < numNodes; i++) {
+        totalConflicts += conflictCount[i];
+        if (conflictCount[i] > 0) {
+            conflictingPos[i] = static_cast<int>(conflictingNodes.size());
+            conflictingNodes.push_back(i);
+        }
+    }
 }
 
 /**
@@ -93,9 +370,19 @@ std::vector<int>& Graph::getConflictCount() {
  * Un conflit est défini comme un sommet ayant des voisins partageant la même couleur.
  */
 void Graph::setConflictCount() {
-    for (const Node& node : nodes) {
-        conflictCount[node.getID()] = node.countConflict(*this);
+    if (isDense()) {
+        rebuildColorClasses();
     }
+    for (int i = 0; i < numNodes; i++) {
+        int count = 0;
+        if (colors[i] != 0) {
+            for (int neighborID : getNeighbors(i)) {
+                count += colors[neighborID] == colors[i];
+            }
+        }
+        conflictCount[i] = count;
+    }
+    rebuildConflictingSet();
 }
 
 
@@ -104,48 +391,28 @@ void Graph::setConflictCount() {
  * @param conflictVector vecteur de conflit à mettre dans notre graphe
  */
 void Graph::setConflictCount(std::vector<int> conflictVector) {
-    for (const Node& node : nodes) {
-        int id = node.getID();
-        conflictCount[id] = conflictVector[id];
+    for (int i = 0; i < numNodes; i++) {
+        conflictCount[i] = conflictVector[i];
     }
+    rebuildConflictingSet();
 }
 
 /**
- * @brief Calcule le nombre de conflits dans le graphe.
+ * @brief Obtient le nombre de conflits dans le graphe, maintenu de manière incrémentale (O(1)).
  * @return Le nombre de conflits (sommets voisins ayant la même couleur).
  */
 int Graph::countConflicts() const {
-    int conflictCpt = 0;
-    for (int i = 0; i < nodes.size(); ++i) {
-        conflictCpt += conflictCount[i];
-    }
-    return conflictCpt / 2;
+    return totalConflicts / 2;
 }
 
 /**
- * @brief Ajoute un noeud au graphe.
- * @param n le noeud à ajouter.
+ * @brief Crée une copie de la coloration du graphe (couleurs et conflits).
+ * La topologie, immuable, est partagée avec la copie.
+ * @return Une nouvelle instance de Graph.
  */
-void Graph::addNode(const Node& n){
-    numNodes++;
-    nodes.push_back(n);
-}
-
-/**
- * @brief Crée une copie en profondeur du graphe.
- * @return Une nouvelle instance de Graph copiée en profondeur.
- */
-Graph Graph::clone(){
-    Graph clonedGraph(0);
-    // Copie en profondeur des nœuds.
-    for (Node& originalNode : nodes) {
-        clonedGraph.addNode(originalNode.clone());
-    }
-    // Initialise le vecteur conflictCount de la copie avec la même taille que le vecteur original
-    clonedGraph.conflictCount.resize(numNodes, 0);
-    // Met à jour le vecteur conflictCount de la copie
-    clonedGraph.setConflictCount(conflictCount);
-    return clonedGraph;
+Graph Graph::clone() const {
+    // Les tableaux de l'état sont copiés, les pointeurs vers la topologie restent valides car elle est partagée
+    return *this;
 }
 
 /**
@@ -153,9 +420,8 @@ Graph Graph::clone(){
  */
 void Graph::displayGraph() const {
     for (int i = 0; i < numNodes; i++) {
-        const Node& node = nodes[i];
-        std::cout << "Node " << i << " - Color: " << node.getColor() << " - Neighbors: ";
-        for (int neighborID : node.getNeighbors()) {
+        std::cout << "Node " << i << " - Color: " << getColor(i) << " - Neighbors: ";
+        for (int neighborID : getNeighbors(i)) {
             std::cout << neighborID << " ";
         }
         std::cout << std::endl;
@@ -172,49 +438,172 @@ void Graph::displayGraph() const {
  * @brief Change aléatoirement la couleur de plusieurs noeuds différents.
  * @param numChange Nombre de noeud à changer.
  * @param k Le nombre de couleur différents.
- * @param rng Générateur de nombres aléatoires.
+ * @param rng Générateur de nombres aléatoires, avancé par les tirages.
+ * @param onlyConflicting true pour ne tirer que des noeuds en conflit.
+ * @return Le nombre de noeuds effectivement recoloriés.
  */
-void Graph::recolorAllNodes(int numChange, int k, std::mt19937 rng){
+int Graph::recolorAllNodes(int numChange, int k, std::mt19937& rng, bool onlyConflicting){
     if (numChange < 0) {
         std::cerr << "Le nombre de noeuds à recolorier ne peut pas être negatif." << std::endl;
-        return;
+        return 0;
     }
 
-    std::uniform_int_distribution<int> distribution(0, numNodes-1);
-
-    // Création d'une liste des couleurs
-    std::vector<int> colorList;
-    colorList.reserve(k);
-    for (int i = 0; i < k; ++i) {
-        colorList.push_back(i);
+    if (k < 2) {
+        return 0; // Aucune autre couleur disponible
     }
 
-    for (int i = 0; i < numChange; i++){
-        Node& node = nodes[distribution(rng)];
-        int currentColor = node.getColor();
+    std::uniform_int_distribution<int> distribution(0, numNodes-1);
+    // Tirage parmi les k-1 couleurs différentes de la couleur courante
+    std::uniform_int_distribution<int> colorDistribution(0, k - 2);
 
-        // On mélange aléatoirement la liste des couleurs
-        std::shuffle(colorList.begin(), colorList.end(), rng);
-        // La nouvelle couleur du noeud est la première couleur de la liste
-        int newColor = colorList[0];
-        // Si cette couleur était la même que l'ancienne, on prend la couleur suivante
-        if (newColor == currentColor){
-            newColor = colorList[1];
+    for (int i = 0; i < numChange; i++){
+        int id = onlyConflicting ? randomConflictingNode(rng) : distribution(rng);
+        if (id < 0) {
+            return i; // Aucun noeud en conflit
+        }
+        int currentColor = getColor(id);
+        int newColor;
+        if (currentColor < 0) {
+            newColor = std::uniform_int_distribution<int>(0, k - 1)(rng); // Noeud sans couleur
+        } else {
+            newColor = colorDistribution(rng);
+            if (newColor >= currentColor) {
+                newColor++;
+            }
         }
 
         // Mettez à jour conflictCount en conséquence
-        for (int neighborID : node.getNeighbors()) {
-            const Node& neighbor = getNode(neighborID);
-            if (neighbor.getColor() == currentColor) {
-                conflictCount[neighborID]--; // Réduction du conflit
-                conflictCount[node.getID()]--;
+        recolorNode(id, newColor);
+    }
+    return numChange;
+}
+
+/**
+ * @brief Calcule la variation du nombre de conflits si le noeud prenait une nouvelle couleur, sans
+ * modifier le graphe.
+ * @param id L'ID du noeud.
+ * @param newColor La couleur envisagée.
+ * @return La variation du nombre de conflits (négative si le changement améliore la solution).
+ */
+int Graph::recolorDelta(int id, int newColor) const {
+    int currentColor = getColor(id);
+    if (newColor == currentColor) {
+        return 0;
+    }
+    if (isDense()) {
+        int delta = countNeighborsWithColor(id, newColor);
+        if (currentColor >= 0) {
+            delta -= countNeighborsWithColor(id, currentColor);
+        }
+        return delta;
+    }
+    // Comparaison directe des couleurs stockées (couleur + 1), un voisin sans couleur vaut 0
+    int delta = 0;
+    int storedCurrent = currentColor + 1;
+    int storedNew = newColor + 1;
+    for (int neighborID : getNeighbors(id)) {
+        int neighborColor = colors[neighborID];
+        if (neighborColor == 0) {
+            continue; // Voisin pas encore colorié
+        }
+        delta += (neighborColor == storedNew) - (neighborColor == storedCurrent);
+    }
+    return delta;
+}
+
+/**
+ * @brief Change la couleur d'un noeud et met à jour conflictCount de manière incrémentale en O(degré).
+ * Le noeud peut ne pas encore avoir de couleur (-1).
+ * @param id L'ID du noeud.
+ * @param newColor La nouvelle couleur.
+ */
+void Graph::recolorNode(int id, int newColor) {
+    int currentColor = getColor(id);
+    if (newColor == currentColor) {
+        return;
+    }
+    if (newColor < 0 || newColor >= MAX_COLORS) {
+        throw std::invalid_argument("La couleur est en dehors de la plage valide.");
+    }
+    if (isDense()) {
+        // Parcours des seuls voisins des deux classes de couleur concernées
+        ensureColorClass(newColor);
+        const std::uint64_t* row = bitsData + static_cast<size_t>(id) * words;
+        std::uint64_t bit = std::uint64_t(1) << (id % 64);
+        if (currentColor >= 0) {
+            std::uint64_t* oldClass = colorClasses.data() + static_cast<size_t>(currentColor) * words;
+            for (int w = 0; w < words; w++) {
+                for (std::uint64_t m = row[w] & oldClass[w]; m != 0; m &= m - 1) {
+                    decrementConflict(w * 64 + lowestBit64(m)); // Réduction du conflit
+                    decrementConflict(id);
+                }
             }
-            if (neighbor.getColor() == newColor) {
-                conflictCount[neighborID]++; // Augmentation du conflit
-                conflictCount[node.getID()]++;
+            oldClass[id / 64] &= ~bit;
+        }
+        std::uint64_t* newClass = colorClasses.data() + static_cast<size_t>(newColor) * words;
+        for (int w = 0; w < words; w++) {
+            for (std::uint64_t m = row[w] & newClass[w]; m != 0; m &= m - 1) {
+                incrementConflict(w * 64 + lowestBit64(m)); // Augmentation du conflit
+                incrementConflict(id);
             }
         }
-        node.setColor(newColor);
+        newClass[id / 64] |= bit;
+        colors[id] = static_cast<Color>(newColor + 1);
+        return;
     }
+    for (int neighborID : getNeighbors(id)) {
+        int neighborColor = getColor(neighborID);
+        if (neighborColor < 0) {
+            continue; // Voisin pas encore colorié
+        }
+        if (neighborColor == currentColor) {
+            decrementConflict(neighborID); // Réduction du conflit
+            decrementConflict(id);
+        } else if (neighborColor == newColor) {
+            incrementConflict(neighborID); // Augmentation du conflit
+            incrementConflict(id);
+        }
+    }
+    colors[id] = static_cast<Color>(newColor + 1);
+}
+
+/**
+ * @brief Retire la couleur de tous les noeuds (-1) et remet conflictCount à zéro.
+ */
+void Graph::clearColoring() {
+    colors.assign(numNodes, 0);
+    conflictCount.assign(numNodes, 0);
+    rebuildConflictingSet();
+    colorClasses.assign(colorClasses.size(), 0);
+}
 
+/**
+ * @brief Obtient la couleur de chaque noeud.
+ * @return Le vecteur des couleurs indexé par l'ID des noeuds.
+ */
+std::vector<int> Graph::getColoring() const {
+    std::vector<int> coloring(numNodes);
+    for (int i = 0; i < numNodes; i++) {
+        coloring[i] = getColor(i);
+    }
+    return coloring;
+}
+
+/**
+ * @brief Applique une coloration complète au graphe et recalcule conflictCount.
+ * @param coloring Le vecteur des couleurs indexé par l'ID des noeuds.
+ * @throw std::invalid_argument si la taille du vecteur ne correspond pas au nombre de noeuds ou si une couleur est
+ * hors de [-1, MAX_COLORS-1].
+ */
+void Graph::setColoring(const std::vector<int>& coloring) {
+    if (static_cast<int>(coloring.size()) != numNodes) {
+        throw std::invalid_argument("La coloration ne correspond pas au nombre de noeuds.");
+    }
+    for (int i = 0; i < numNodes; i++) {
+        if (coloring[i] < -1 || coloring[i] >= MAX_COLORS) {
+            throw std::invalid_argument("La couleur est en dehors de la plage valide.");
+        }
+        colors[i] = static_cast<Color>(coloring[i] + 1);
+    }
+    setConflictCount();
 }
\ No newline at end of file
@@ -0,0 +1,283 @@
+/**
+ * @file GraphGenerator.cpp
+ * @brief Implémente les générateurs de graphes synthétiques (G(n, p), Leighton, plats).
+ */
+
+#include "../include/GraphGenerator.h"
+#include "../include/Annealing.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    // Le plus grand nombre d'arêtes dont la table d'adjacence (2m entrées indexées par des int) tient en mémoire.
+    constexpr long long MAX_EDGES = std::numeric_limits<int>::max() / 2;
+    // Densité maximale des graphes de Leighton : au-delà, la plupart des cliques tirées ne font que répéter des arêtes
+    // existantes et le nombre de tours nécessaires pour atteindre la densité explose.
+    constexpr double LEIGHTON_MAX_DENSITY = 0.5;
+
+    // Flux aléatoire des générateurs : xoshiro256** et tirages sans distribution de la bibliothèque standard, le
+    // graphe d'une graine est donc le même avec tous les compilateurs
+    using GeneratorStream = RandomStream<Xoshiro256>;
+
+    /**
+     * @brief Vérifie les paramètres communs aux générateurs.
+     * @param numNodes Le nombre de noeuds.
+     * @param p La densité.
+     * @throw std::invalid_argument si numNodes est négatif ou si p est hors de [0, 1].
+     */
+    void checkParameters(int numNodes, double p) {
+        if (numNodes < 0) {
+            throw std::invalid_argument("Le nombre de noeuds doit être positif ou nul.");
+        }
+        if (!(p >= 0 && p <= 1)) {
+            throw std::invalid_argument("La densité doit être dans [0, 1].");
+        }
+    }
+
+    /**
+     * @brief Vérifie que le nombre d'arêtes visé tient dans la table d'adjacence.
+     * @param edges Le nombre d'arêtes visé.
+     * @throw std::invalid_argument si le nombre d'arêtes dépasse MAX_EDGES.
+     */
+    void checkEdgeCount(double edges) {
+        if (edges > static_cast<double>(MAX_EDGES)) {
+            throw std::invalid_argument("Le graphe demandé dépasse " + std::to_string(MAX_EDGES) + " arêtes.");
+        }
+    }
+
+    /**
+     * @brief Répartit les noeuds en k classes de même taille (à un noeud près) dans un ordre aléatoire.
+     * @param numNodes Le nombre de noeuds, au moins k.
+     * @param k Le nombre de classes, au moins 2.
+     * @param stream Le flux aléatoire.
+     * @param graph Le graphe, dont la coloration cachée reçoit la classe de chaque noeud.
+     * @return Les noeuds de chaque classe.
+     * @throw std::invalid_argument si k < 2 ou si numNodes < k.
+     */
+    std::vector<std::vector<int>> plantClasses(int numNodes, int k, GeneratorStream& stream, GeneratedGraph& graph) {
+        if (k < 2 || numNodes < k) {
+            throw std::invalid_argument("Le nombre de classes doit être dans [2, nombre de noeuds].");
+        }
+        std::vector<int> order(numNodes);
+        std::iota(order.begin(), order.end(), 0);
+        for (int i = numNodes - 1; i > 0; i--) {
+            std::swap(order[i], order[stream.below(i + 1)]);
+        }
+        std::vector<std::vector<int>> classes(k);
+        graph.planted.assign(numNodes, 0);
+        for (int i = 0; i < numNodes; i++) {
+            classes[i % k].push_back(order[i]);
+            graph.planted[order[i]] = i % k;
+        }
+        return classes;
+    }
+
+    /**
+     * @param classes Les noeuds de chaque classe.
+     * @return Le nombre de paires de noeuds de classes différentes.
+     */
+    double crossClassPairs(const std::vector<std::vector<int>>& classes) {
+        double total = 0;
+        double squares = 0;
+        for (const std::vector<int>& members : classes) {
+            total += static_cast<double>(members.size());
+            squares += static_cast<double>(members.size()) * static_cast<double>(members.size());
+        }
+        return (total * total - squares) / 2;
+    }
+}
+
+/**
+ * @brief Graphe aléatoire G(n, p) (famille DSJC) : chaque paire de noeuds est reliée avec la probabilité p.
+ * @param numNodes Le nombre de noeuds.
+ * @param p La probabilité d'une arête, dans [0, 1].
+ * @param seed La graine : une même graine produit le même graphe sur toutes les plateformes.
+ * @return Le graphe.
+ * @throw std::invalid_argument si les paramètres sont hors de leur domaine ou si le graphe dépasse 2^30 arêtes.
+ */
+GeneratedGraph generateRandomGraph(int numNodes, double p, std::uint64_t seed) {
+    checkParameters(numNodes, p);
+    double pairs = static_cast<double>(numNodes) * (numNodes - 1.0) / 2;
+    checkEdgeCount(p * pairs * 1.001 + 6 * std::sqrt(p * pairs));
+    GeneratedGraph graph;
+    graph.numNodes = numNodes;
+    if (p <= 0) {
+        return graph;
+    }
+    graph.edges.reserve(static_cast<size_t>(p * pairs * 1.001 + 6 * std::sqrt(p * pairs)));
+    if (p >= 1) {
+        for (int v = 1; v < numNodes; v++) {
+            for (int w = 0; w < v; w++) {
+                graph.edges.emplace_back(v, w);
+            }
+        }
+        return graph;
+    }
+
+    // Parcours des paires (v, w), w < v, dans l'ordre : le nombre de paires sautées avant la prochaine arête suit une
+    // loi géométrique de paramètre p
+    GeneratorStream stream(seed);
+    double logMiss = std::log1p(-p);
+    long long v = 1;
+    long long w = -1;
+    while (v < numNodes) {
+        double skip = std::floor(std::log1p(-stream.unit()) / logMiss);
+        if (skip >= pairs) {
+            break;
+        }
+        w += 1 + static_cast<long long>(skip);
+        while (w >= v && v < numNodes) {
+            w -= v;
+            v++;
+        }
+        if (v < numNodes) {
+            if (static_cast<long long>(graph.edges.size()) == MAX_EDGES) {
+                checkEdgeCount(static_cast<double>(MAX_EDGES) + 1);
+            }
+            graph.edges.emplace_back(static_cast<int>(v), static_cast<int>(w));
+        }
+    }
+    return graph;
+}
+
+/**
+ * @brief Graphe de type Leighton : les noeuds sont répartis en k classes de même taille et les arêtes proviennent de
+ * cliques dont chaque noeud est pris dans une classe différente.
+ * @param numNodes Le nombre de noeuds, au moins k.
+ * @param k Le nombre de classes, au moins 2.
+ * @param p La densité des arêtes entre classes différentes, dans [0, 0.5].
+ * @param seed La graine : une même graine produit le même graphe sur toutes les plateformes.
+ * @return Le graphe et sa coloration cachée.
+ * @throw std::invalid_argument si les paramètres sont hors de leur domaine ou si le graphe dépasse 2^30 arêtes.
+ */
+GeneratedGraph generateLeightonGraph(int numNodes, int k, double p, std::uint64_t seed) {
+    checkParameters(numNodes, p);
+    if (p > LEIGHTON_MAX_DENSITY) {
+        throw std::invalid_argument("La densité d'un graphe de Leighton doit être au plus 0.5.");
+    }
+    GeneratorStream stream(seed);
+    GeneratedGraph graph;
+    graph.numNodes = numNodes;
+    std::vector<std::vector<int>> classes = plantClasses(numNodes, k, stream, graph);
+    double maxEdges = crossClassPairs(classes);
+    checkEdgeCount(p * maxEdges);
+    auto target = static_cast<size_t>(std::llround(p * maxEdges));
+
+    // Les arêtes sont codées (min << 32 | max) : le tri suivi de std::unique retire les arêtes de plusieurs cliques
+    std::vector<std::uint64_t> keys;
+    keys.reserve(target + static_cast<size_t>(k) * k);
+    std::vector<int> classOrder(k);
+    std::iota(classOrder.begin(), classOrder.end(), 0);
+    std::vector<int> members;
+    auto addClique = [&](int size) {
+        // Tirage de size classes distinctes (début d'un mélange de Fisher-Yates), un noeud par classe
+        members.clear();
+        for (int i = 0; i < size; i++) {
+            std::swap(classOrder[i], classOrder[i + stream.below(k - i)]);
+            const std::vector<int>& candidates = classes[classOrder[i]];
+            members.push_back(candidates[stream.below(static_cast<int>(candidates.size()))]);
+        }
+        for (int i = 0; i < size; i++) {
+            for (int j = i + 1; j < size; j++) {
+                auto [u, w] = std::minmax(members[i], members[j]);
+                keys.push_back(static_cast<std::uint64_t>(u) << 32 | static_cast<std::uint32_t>(w));
+            }
+        }
+    };
+
+    // La clique de taille k rend le nombre chromatique égal à k
+    if (target > 0) {
+        addClique(k);
+    }
+    size_t unique = 0;
+    while (unique < target) {
+        // Chaque tour ajoute autant d'arêtes qu'il en manque, puis fusionne le lot avec les arêtes déjà triées
+        size_t goal = keys.size() + (target - unique);
+        while (keys.size() < goal) {
+            addClique(2 + stream.below(k - 1));
+        }
+        auto merged = keys.begin() + static_cast<std::ptrdiff_t>(unique);
+        std::sort(merged, keys.end());
+        std::inplace_merge(keys.begin(), merged, keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        unique = keys.size();
+    }
+    graph.edges.reserve(keys.size());
+    for (std::uint64_t key : keys) {
+        graph.edges.emplace_back(static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu));
+    }
+    return graph;
+}
+
+/**
+ * @brief Graphe plat (famille flat de Culberson) : les noeuds sont répartis en k classes de même taille, chaque paire
+ * de classes reçoit le même nombre d'arêtes et les degrés d'un noeud vers chaque autre classe diffèrent d'au plus un.
+ * @param numNodes Le nombre de noeuds, au moins k.
+ * @param k Le nombre de classes, au moins 2.
+ * @param p La densité des arêtes entre classes différentes, dans [0, 1].
+ * @param seed La graine : une même graine produit le même graphe sur toutes les plateformes.
+ * @return Le graphe et sa coloration cachée.
+ * @throw std::invalid_argument si les paramètres sont hors de leur domaine ou si le graphe dépasse 2^30 arêtes.
+ */
+GeneratedGraph generateFlatGraph(int numNodes, int k, double p, std::uint64_t seed) {
+    checkParameters(numNodes, p);
+    GeneratorStream stream(seed);
+    GeneratedGraph graph;
+    graph.numNodes = numNodes;
+    std::vector<std::vector<int>> classes = plantClasses(numNodes, k, stream, graph);
+    checkEdgeCount(p * crossClassPairs(classes));
+    graph.edges.reserve(static_cast<size_t>(p * crossClassPairs(classes)) + static_cast<size_t>(k) * k);
+
+    for (int c = 0; c < k; c++) {
+        for (int d = c + 1; d < k; d++) {
+            const std::vector<int>& from = classes[c];
+            const std::vector<int>& to = classes[d];
+            auto fromSize = static_cast<std::uint64_t>(from.size());
+            auto toSize = static_cast<std::uint64_t>(to.size());
+            auto count = static_cast<std::uint64_t>(std::llround(p * static_cast<double>(fromSize * toSize)));
+            if (count == 0) {
+                continue;
+            }
+            // L'arête t relie le noeud t * |from| / count de from (blocs consécutifs de t, de même taille à un près)
+            // au noeud offset + t * stride (mod |to|) de to : le pas, premier avec |to|, rend distincts les voisins
+            // d'un même bloc et chaque noeud de to reçoit le même nombre d'arêtes à un près
+            std::uint64_t offset = static_cast<std::uint64_t>(stream.below(static_cast<int>(toSize)));
+            std::uint64_t stride = 1;
+            if (toSize > 2) {
+                do {
+                    stride = 1 + static_cast<std::uint64_t>(stream.below(static_cast<int>(toSize - 1)));
+                } while (std::gcd(stride, toSize) != 1);
+            }
+            for (std::uint64_t t = 0; t < count; t++) {
+                graph.edges.emplace_back(from[t * fromSize / count], to[(offset + t * stride) % toSize]);
+            }
+        }
+    }
+    return graph;
+}
+
+/**
+ * @brief Génère un graphe de la famille donnée.
+ * @param type La famille : "gnp", "leighton" ou "flat".
+ * @param numNodes Le nombre de noeuds.
+ * @param k Le nombre de classes (ignoré pour "gnp").
+ * @param p La densité (probabilité d'une arête pour "gnp", densité entre classes sinon).
+ * @param seed La graine.
+ * @return Le graphe.
+ * @throw std::invalid_argument si la famille est inconnue ou si les paramètres sont hors de leur domaine.
+ */
+GeneratedGraph generateGraph(const std::string& type, int numNodes, int k, double p, std::uint64_t seed) {
+    if (type == "gnp") {
+        return generateRandomGraph(numNodes, p, seed);
+    }
+    if (type == "leighton") {
+        return generateLeightonGraph(numNodes, k, p, seed);
+    }
+    if (type == "flat") {
+        return generateFlatGraph(numNodes, k, p, seed);
+    }
+    throw std::invalid_argument("Famille de graphes inconnue : " + type);
+}
@@ -0,0 +1,420 @@
+/**
+ * @file GraphLoader.cpp
+ * @brief Implémente le chargement d'un graphe DIMACS projeté en mémoire et le cache binaire CSR.
+ */
+
+#include "../include/GraphLoader.h"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Signature et version du cache binaire.
+    constexpr char CACHE_MAGIC[8] = {'K', 'C', 'O', 'L', 'C', 'S', 'R', '\0'};
+    constexpr std::uint32_t CACHE_VERSION = 1;
+
+    /**
+     * @struct CacheHeader
+     * @brief En-tête du cache binaire, suivi des offsets (numNodes + 1 entiers) puis des voisins.
+     */
+    struct CacheHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::int32_t numNodes;
+        std::int64_t adjacencySize;
+        std::int64_t sourceSize; // Taille du fichier source, -1 si inconnue.
+        std::int64_t sourceTime; // Date de modification du fichier source, 0 si inconnue.
+    };
+
+    /**
+     * @class MappedFile
+     * @brief Projection en lecture seule d'un fichier en mémoire (lecture complète sur les systèmes sans mmap).
+     */
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& filename) {
+#if defined(_WIN32)
+            std::ifstream file(filename, std::ios::binary);
+            if (!file.is_open()) {
+                return;
+            }
+            buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            data = buffer.data();
+            length = buffer.size();
+            valid = true;
+#else
+            int fd = ::open(filename.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st{};
+            if (::fstat(fd, &st) == 0) {
+                length = static_cast<size_t>(st.st_size);
+                if (length == 0) {
+                    valid = true;
+                } else {
+                    void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (mapping != MAP_FAILED) {
+                        ::madvise(mapping, length, MADV_SEQUENTIAL);
+                        data = static_cast<const char*>(mapping);
+                        valid = true;
+                    }
+                }
+            }
+            ::close(fd);
+#endif
+        }
+
+        ~MappedFile() {
+#if !defined(_WIN32)
+            if (data != nullptr) {
+                ::munmap(const_cast<char*>(data), length);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        [[nodiscard]] bool isValid() const { return valid; }
+        [[nodiscard]] const char* begin() const { return data; }
+        [[nodiscard]] const char* end() const { return data + length; }
+        [[nodiscard]] size_t size() const { return length; }
+
+    private:
+        const char* data = nullptr;
+        size_t length = 0;
+        bool valid = false;
+#if defined(_WIN32)
+        std::vector<char> buffer;
+#endif
+    };
+
+    /**
+     * @brief Avance le curseur après les espaces et tabulations (sans passer la fin de ligne).
+     */
+    inline void skipBlanks(const char*& p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            p++;
+        }
+    }
+
+    /**
+     * @brief Avance le curseur au début de la ligne suivante.
+     */
+    inline void skipLine(const char*& p, const char* end) {
+        const void* eol = std::memchr(p, '\n', static_cast<size_t>(end - p));
+        p = eol == nullptr ? end : static_cast<const char*>(eol) + 1;
+    }
+
+    /**
+     * @brief Lit un entier décimal (éventuellement négatif) précédé d'espaces.
+     * @return false si aucun chiffre n'a été trouvé ou si la valeur absolue dépasse INT_MAX.
+     */
+    inline bool parseInt(const char*& p, const char* end, long long& value) {
+        skipBlanks(p, end);
+        bool negative = false;
+        if (p < end && *p == '-') {
+            negative = true;
+            p++;
+        }
+        if (p == end || *p < '0' || *p > '9') {
+            return false;
+        }
+        long long result = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            result = result * 10 + (*p - '0');
+            p++;
+            if (result > INT_MAX) {
+                return false;
+            }
+        }
+        value = negative ? -result : result;
+        return true;
+    }
+}
+
+/**
+ * @brief Obtient la taille et la date de modification d'un fichier source (l'empreinte qui invalide le cache binaire).
+ * @param sourceFile Le nom du fichier.
+ * @param size La taille du fichier, non modifiée en cas d'échec.
+ * @param time La date de modification du fichier, non modifiée en cas d'échec.
+ * @return false si le fichier n'existe pas.
+ */
+bool sourceStamp(const std::string& sourceFile, std::int64_t& size, std::int64_t& time) {
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(sourceFile, ec);
+    if (ec) {
+        return false;
+    }
+    auto writeTime = std::filesystem::last_write_time(sourceFile, ec);
+    if (ec) {
+        return false;
+    }
+    size = static_cast<std::int64_t>(fileSize);
+    time = static_cast<std::int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+/**
+ * @brief Lit un graphe au format DIMACS sans utiliser de cache.
+ * @param filename Le nom du fichier contenant les données du graphe au format DIMACS.
+ * @return Un objet Graph représentant le graphe extrait du fichier.
+ * @throw std::invalid_argument si le fichier ne peut pas être ouvert ou s'il y a des erreurs dans le format du fichier.
+ */
+Graph readDimacsFile(const std::string& filename) {
+    MappedFile file(filename);
+    if (!file.isValid()) {
+        throw std::invalid_argument("Impossible d'ouvrir le fichier: " + filename);
+    }
+
+    long long numNodes = -1;
+    long long numEdges = 0;
+    std::vector<std::pair<int, int>> edges;
+    // Estimation grossière du nombre d'arêtes avant la lecture de la ligne p
+    edges.reserve(file.size() / 12);
+
+    const char* p = file.begin();
+    const char* end = file.end();
+    while (p < end) {
+        skipBlanks(p, end);
+        if (p == end) {
+            break;
+        }
+        switch (*p) {
+            case '\n':
+                p++;
+                break;
+            case 'c':
+                skipLine(p, end);
+                break;
+            case 'p': {
+                p++;
+                skipBlanks(p, end);
+                // Format du problème ("edge" ou "col")
+                while (p < end && *p != ' ' && *p != '\t' && *p != '\n') {
+                    p++;
+                }
+                if (!parseInt(p, end, numNodes) || !parseInt(p, end, numEdges) || numNodes < 0) {
+                    throw std::invalid_argument("Impossible d'extraire numNodes et numEdges: " + filename);
+                }
+                skipLine(p, end);
+                break;
+            }
+            case 'e': {
+                p++;
+                long long u, v;
+                if (!parseInt(p, end, u) || !parseInt(p, end, v)) {
+                    throw std::invalid_argument("Impossible de lire les arêtes: " + filename);
+                }
+                if (u < 1 || v < 1) {
+                    throw std::invalid_argument("Les IDs des arêtes doivent être supérieurs ou égaux à 1.");
+                }
+                // Vérifié avant la conversion en int (une arête avant la ligne p est aussi hors de la plage)
+                if (u > numNodes || v > numNodes) {
+                    throw std::invalid_argument("Les ID de noeuds sont en dehors de la plage valide.");
+                }
+                edges.emplace_back(static_cast<int>(u - 1), static_cast<int>(v - 1));
+                skipLine(p, end);
+                break;
+            }
+            default:
+                throw std::invalid_argument("Impossible de lire les arêtes: " + filename);
+        }
+    }
+
+    if (numNodes < 0) {
+        throw std::invalid_argument("Ligne p manquante: " + filename);
+    }
+    // Creation du graphe
+    return Graph(static_cast<int>(numNodes), edges);
+}
+
+/**
+ * @brief Obtient le nom du cache binaire associé à un fichier DIMACS.
+ * @param filename Le nom du fichier DIMACS.
+ * @return Le nom du fichier de cache.
+ */
+std::string graphCachePath(const std::string& filename) {
+    return filename + ".csr";
+}
+
+/**
+ * @brief Écrit la table d'adjacence CSR d'un graphe dans un cache binaire.
+ *
+ * Le fichier est d'abord écrit sous un nom temporaire puis renommé, un cache partiellement écrit n'est donc jamais
+ * lu. La taille et la date de modification du fichier source sont enregistrées pour invalider le cache.
+ *
+ * @param graph Le graphe à écrire.
+ * @param cacheFile Le nom du fichier de cache.
+ * @param sourceFile Le nom du fichier DIMACS source, vide si le graphe n'a pas de fichier source.
+ * @return true si le cache a été écrit.
+ */
+bool writeGraphCache(const Graph& graph, const std::string& cacheFile, const std::string& sourceFile) {
+    const std::vector<int>& offsets = graph.getAdjOffsets();
+    const std::vector<int>& adjacency = graph.getAdjacency();
+
+    CacheHeader header{};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.numNodes = graph.getNumNodes();
+    header.adjacencySize = static_cast<std::int64_t>(adjacency.size());
+    header.sourceSize = -1;
+    header.sourceTime = 0;
+    if (!sourceFile.empty() && !sourceStamp(sourceFile, header.sourceSize, header.sourceTime)) {
+        return false;
+    }
+
+    std::string tmpFile = cacheFile + ".tmp";
+    {
+        std::ofstream out(tmpFile, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(offsets.data()),
+                  static_cast<std::streamsize>(offsets.size() * sizeof(int)));
+        out.write(reinterpret_cast<const char*>(adjacency.data()),
+                  static_cast<std::streamsize>(adjacency.size() * sizeof(int)));
+        if (!out) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpFile, cacheFile, ec);
+    if (ec) {
+        std::filesystem::remove(tmpFile, ec);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Lit un graphe depuis un cache binaire.
+ * @param cacheFile Le nom du fichier de cache.
+ * @param sourceFile Le nom du fichier DIMACS source, vide pour ne pas vérifier que le cache est à jour.
+ * @param graph Le graphe lu, non modifié en cas d'échec.
+ * @return true si le cache existe, est valide et est à jour.
+ */
+bool readGraphCache(const std::string& cacheFile, const std::string& sourceFile, Graph& graph) {
+    MappedFile file(cacheFile);
+    if (!file.isValid() || file.size() < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header{};
+    std::memcpy(&header, file.begin(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION
+        || header.numNodes < 0 || header.adjacencySize < 0) {
+        return false;
+    }
+    size_t numOffsets = static_cast<size_t>(header.numNodes) + 1;
+    size_t adjacencySize = static_cast<size_t>(header.adjacencySize);
+    if (file.size() != sizeof(header) + (numOffsets + adjacencySize) * sizeof(int)) {
+        return false;
+    }
+    if (!sourceFile.empty()) {
+        std::int64_t size, time;
+        if (!sourceStamp(sourceFile, size, time) || size != header.sourceSize || time != header.sourceTime) {
+            return false;
+        }
+    }
+
+    const char* data = file.begin() + sizeof(header);
+    std::vector<int> offsets(numOffsets);
+    std::vector<int> adjacency(adjacencySize);
+    std::memcpy(offsets.data(), data, numOffsets * sizeof(int));
+    std::memcpy(adjacency.data(), data + numOffsets * sizeof(int), adjacencySize * sizeof(int));
+    try {
+        graph = Graph(std::move(offsets), std::move(adjacency));
+    } catch (const std::invalid_argument&) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Lit un graphe à partir d'un fichier au format DIMACS et crée un objet Graph correspondant.
+ *
+ * Le fichier est projeté en mémoire puis analysé avec un lecteur d'entiers écrit à la main. Les lignes `c`, `p` et
+ * `e` peuvent apparaître dans n'importe quel ordre. Si useCache vaut true, un cache binaire (en-tête et tableaux CSR)
+ * situé à côté du fichier source est utilisé s'il est à jour, et créé sinon. Un fichier dont le nom se termine par
+ * `.csr` est lu directement comme un cache binaire (graphes produits par le générateur sans fichier DIMACS).
+ *
+ * @param filename Le nom du fichier contenant les données du graphe au format DIMACS, ou un cache binaire `.csr`.
+ * @param useCache true pour lire et écrire le cache binaire.
+ * @return Un objet Graph représentant le graphe extrait du fichier.
+ * @throw std::invalid_argument si le fichier ne peut pas être ouvert ou s'il y a des erreurs dans le format du fichier.
+ */
+Graph readGraphFromFile(const std::string& filename, bool useCache) {
+    if (std::filesystem::path(filename).extension() == ".csr") {
+        Graph graph;
+        if (!readGraphCache(filename, "", graph)) {
+            throw std::invalid_argument("Cache binaire illisible ou invalide: " + filename);
+        }
+        return graph;
+    }
+    if (!useCache) {
+        return readDimacsFile(filename);
+    }
+    std::string cacheFile = graphCachePath(filename);
+    Graph graph;
+    if (readGraphCache(cacheFile, filename, graph)) {
+        return graph;
+    }
+    graph = readDimacsFile(filename);
+    if (!writeGraphCache(graph, cacheFile, filename)) {
+        std::cerr << "Impossible d'écrire le cache: " << cacheFile << std::endl;
+    }
+    return graph;
+}
+
+/**
+ * @brief Écrit un graphe au format DIMACS (`p edge`, puis une ligne `e u v` par arête, noeuds numérotés à partir de 1).
+ * @param filename Le nom du fichier à écrire.
+ * @param numNodes Le nombre de noeuds.
+ * @param edges Les arêtes (u, v), ID dans [0, numNodes-1].
+ * @param comment Le commentaire écrit en tête du fichier (ligne `c`), aucun s'il est vide.
+ * @throw std::runtime_error si le fichier ne peut pas être écrit.
+ */
+void writeDimacsFile(const std::string& filename, int numNodes, const std::vector<std::pair<int, int>>& edges,
+                     const std::string& comment) {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Impossible d'écrire le fichier: " + filename);
+    }
+    if (!comment.empty()) {
+        out << "c " << comment << "\n";
+    }
+    out << "p edge " << numNodes << " " << edges.size() << "\n";
+
+    // Les lignes sont formatées dans un tampon écrit par blocs : les flux formatés sont trop lents pour 10^7 arêtes
+    std::string buffer;
+    buffer.reserve(1 << 20);
+    char line[32];
+    for (const auto& [u, v] : edges) {
+        int length = std::snprintf(line, sizeof(line), "e %d %d\n", u + 1, v + 1);
+        buffer.append(line, static_cast<size_t>(length));
+        if (buffer.size() > (1 << 20) - sizeof(line)) {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!out) {
+        throw std::runtime_error("Impossible d'écrire le fichier: " + filename);
+    }
+}
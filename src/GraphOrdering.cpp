@@ -0,0 +1,200 @@
+/**
+ * @file GraphOrdering.cpp
+ * @brief Implémente les renumérotations des noeuds (Cuthill-McKee inverse, degrés décroissants, parcours en largeur).
+ */
+
+#include "../include/GraphOrdering.h"
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Parcours en largeur d'une composante, les voisins étant visités dans l'ordre de la table d'adjacence ou
+     * par degré croissant.
+     * @param graph Le graphe.
+     * @param root Le noeud de départ, non visité.
+     * @param level Le niveau de chaque noeud, -1 s'il n'est pas visité ; rempli pour les noeuds de la composante.
+     * @param order Les noeuds visités sont ajoutés à la fin, dans l'ordre du parcours.
+     * @param byDegree true pour visiter les voisins d'un noeud par degré croissant (Cuthill-McKee).
+     * @return L'excentricité de root (niveau du dernier noeud visité).
+     */
+    int breadthFirst(const Graph& graph, int root, std::vector<int>& level, std::vector<int>& order, bool byDegree) {
+        size_t head = order.size();
+        level[root] = 0;
+        order.push_back(root);
+        for (; head < order.size(); head++) {
+            int x = order[head];
+            size_t first = order.size();
+            for (int u : graph.getNeighbors(x)) {
+                if (level[u] < 0) {
+                    level[u] = level[x] + 1;
+                    order.push_back(u);
+                }
+            }
+            if (byDegree) {
+                std::sort(order.begin() + static_cast<std::ptrdiff_t>(first), order.end(), [&graph](int a, int b) {
+                    return graph.getDegree(a) != graph.getDegree(b) ? graph.getDegree(a) < graph.getDegree(b) : a < b;
+                });
+            }
+        }
+        return level[order.back()];
+    }
+
+    /**
+     * @brief Cherche un noeud pseudo-périphérique (heuristique de George et Liu) : on part de root et on passe au
+     * noeud de plus petit degré du dernier niveau tant que l'excentricité augmente.
+     * @param graph Le graphe.
+     * @param root Un noeud de la composante, non visité.
+     * @param level Le niveau de chaque noeud, -1 pour tous les noeuds de la composante ; inchangé au retour.
+     * @param scratch Tampon du parcours, vide au retour.
+     * @return Le noeud pseudo-périphérique.
+     */
+    int pseudoPeripheralNode(const Graph& graph, int root, std::vector<int>& level, std::vector<int>& scratch) {
+        int eccentricity = -1;
+        while (true) {
+            int reached = breadthFirst(graph, root, level, scratch, false);
+            int candidate = root;
+            for (auto it = scratch.rbegin(); it != scratch.rend() && level[*it] == reached; ++it) {
+                if (candidate == root || graph.getDegree(*it) < graph.getDegree(candidate)) {
+                    candidate = *it;
+                }
+            }
+            for (int v : scratch) {
+                level[v] = -1;
+            }
+            scratch.clear();
+            if (reached <= eccentricity) {
+                return root;
+            }
+            eccentricity = reached;
+            root = candidate;
+        }
+    }
+}
+
+/**
+ * @return Les noms des renumérotations disponibles : "rcm", "degree" et "bfs".
+ */
+const std::vector<std::string>& orderingNames() {
+    static const std::vector<std::string> names = {"rcm", "degree", "bfs"};
+    return names;
+}
+
+/**
+ * @brief Calcule l'ordre des noeuds d'une renumérotation.
+ * @param graph Le graphe.
+ * @param method Le nom de la renumérotation (voir orderingNames).
+ * @return order[i] : l'ID dans le graphe du noeud qui reçoit le numéro i.
+ * @throw std::invalid_argument si la renumérotation est inconnue.
+ */
+std::vector<int> vertexOrdering(const Graph& graph, const std::string& method) {
+    int numNodes = graph.getNumNodes();
+    std::vector<int> order;
+    order.reserve(numNodes);
+    if (method == "degree") {
+        order.resize(numNodes);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&graph](int a, int b) {
+            return graph.getDegree(a) > graph.getDegree(b);
+        });
+    } else if (method == "bfs") {
+        std::vector<int> level(numNodes, -1);
+        for (int v = 0; v < numNodes; v++) {
+            if (level[v] < 0) {
+                breadthFirst(graph, v, level, order, false);
+            }
+        }
+    } else if (method == "rcm") {
+        // Les composantes sont prises à partir de leur noeud de plus petit degré
+        std::vector<int> candidates(numNodes);
+        std::iota(candidates.begin(), candidates.end(), 0);
+        std::stable_sort(candidates.begin(), candidates.end(), [&graph](int a, int b) {
+            return graph.getDegree(a) < graph.getDegree(b);
+        });
+        std::vector<int> level(numNodes, -1);
+        std::vector<int> scratch;
+        for (int v : candidates) {
+            if (level[v] < 0) {
+                breadthFirst(graph, pseudoPeripheralNode(graph, v, level, scratch), level, order, true);
+            }
+        }
+        std::reverse(order.begin(), order.end());
+    } else {
+        throw std::invalid_argument("Renumerotation inconnue : " + method);
+    }
+    return order;
+}
+
+/**
+ * @brief Renumérote les noeuds du graphe et reconstruit sa table d'adjacence (et sa matrice de bits s'il est dense).
+ * La coloration du graphe n'est pas reprise.
+ * @param graph Le graphe d'origine.
+ * @param method Le nom de la renumérotation (voir orderingNames).
+ * @return Le graphe renuméroté et la permutation.
+ * @throw std::invalid_argument si la renumérotation est inconnue.
+ */
+Reordering reorderGraph(const Graph& graph, const std::string& method) {
+    int numNodes = graph.getNumNodes();
+    Reordering reordering;
+    reordering.newToOriginal = vertexOrdering(graph, method);
+    std::vector<int> originalToNew(numNodes);
+    for (int i = 0; i < numNodes; i++) {
+        originalToNew[reordering.newToOriginal[i]] = i;
+    }
+
+    // Table d'adjacence CSR renumérotée, voisins triés pour que les parcours lisent la mémoire dans l'ordre
+    std::vector<int> offsets(static_cast<size_t>(numNodes) + 1, 0);
+    std::vector<int> adjacency;
+    adjacency.reserve(graph.getAdjacency().size());
+    for (int i = 0; i < numNodes; i++) {
+        auto first = adjacency.end() - adjacency.begin();
+        for (int u : graph.getNeighbors(reordering.newToOriginal[i])) {
+            adjacency.push_back(originalToNew[u]);
+        }
+        std::sort(adjacency.begin() + first, adjacency.end());
+        offsets[i + 1] = static_cast<int>(adjacency.size());
+    }
+    reordering.graph = Graph(std::move(offsets), std::move(adjacency));
+    return reordering;
+}
+
+/**
+ * @brief Ramène une coloration du graphe renuméroté vers la numérotation d'origine.
+ * @param reordering La renumérotation obtenue avec reorderGraph.
+ * @param coloring La coloration du graphe renuméroté.
+ * @return La coloration indexée par les ID d'origine.
+ * @throw std::invalid_argument si coloring ne correspond pas au graphe renuméroté.
+ */
+std::vector<int> restoreOriginalColoring(const Reordering& reordering, const std::vector<int>& coloring) {
+    if (coloring.size() != reordering.newToOriginal.size()) {
+        throw std::invalid_argument("La coloration ne correspond pas au graphe renuméroté.");
+    }
+    std::vector<int> original(coloring.size());
+    for (size_t i = 0; i < coloring.size(); i++) {
+        original[reordering.newToOriginal[i]] = coloring[i];
+    }
+    return original;
+}
+
+/**
+ * @brief Mesure la localité de la table d'adjacence d'un graphe.
+ * @param graph Le graphe.
+ * @return La largeur de bande et l'écart moyen entre voisins.
+ */
+AdjacencyLocality adjacencyLocality(const Graph& graph) {
+    AdjacencyLocality locality;
+    long long totalGap = 0;
+    long long entries = 0;
+    for (int v = 0; v < graph.getNumNodes(); v++) {
+        for (int u : graph.getNeighbors(v)) {
+            int gap = std::abs(u - v);
+            locality.bandwidth = std::max(locality.bandwidth, gap);
+            totalGap += gap;
+            entries++;
+        }
+    }
+    locality.meanGap = entries > 0 ? static_cast<double>(totalGap) / static_cast<double>(entries) : 0.0;
+    return locality;
+}
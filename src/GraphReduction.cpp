@@ -0,0 +1,110 @@
+/**
+ * @file GraphReduction.cpp
+ * @brief Implémente le retrait des noeuds de degré inférieur à k et leur réinsertion.
+ */
+
+#include "../include/GraphReduction.h"
+#include <stdexcept>
+
+/**
+ * @brief Retire itérativement les noeuds de degré inférieur à k.
+ *
+ * Un noeud qui a moins de k voisins peut toujours recevoir une couleur libre une fois ses voisins coloriés : il est
+ * retiré, ce qui diminue le degré de ses voisins, et ainsi de suite jusqu'à ce que tous les noeuds restants aient au
+ * moins k voisins dans le noyau. Le coût est en O(n + m).
+ *
+ * @param graph Le graphe complet.
+ * @param k Le nombre de couleur utilisable.
+ * @return Le noyau et les noeuds retirés.
+ */
+Reduction peelLowDegree(const Graph& graph, int k) {
+    int numNodes = graph.getNumNodes();
+    Reduction reduction;
+    std::vector<int> degree(numNodes);
+    std::vector<bool> removed(numNodes, false);
+
+    // File des noeuds à retirer : reduction.removed sert de file, head est l'indice du prochain noeud à traiter
+    for (int v = 0; v < numNodes; v++) {
+        degree[v] = graph.getDegree(v);
+        if (degree[v] < k) {
+            removed[v] = true;
+            reduction.removed.push_back(v);
+        }
+    }
+    for (size_t head = 0; head < reduction.removed.size(); head++) {
+        for (int u : graph.getNeighbors(reduction.removed[head])) {
+            if (!removed[u] && --degree[u] < k) {
+                removed[u] = true;
+                reduction.removed.push_back(u);
+            }
+        }
+    }
+
+    // Numérotation des noeuds du noyau
+    std::vector<int> originalToCore(numNodes, -1);
+    for (int v = 0; v < numNodes; v++) {
+        if (!removed[v]) {
+            originalToCore[v] = static_cast<int>(reduction.coreToOriginal.size());
+            reduction.coreToOriginal.push_back(v);
+        }
+    }
+
+    // Table d'adjacence CSR du sous-graphe induit
+    std::vector<int> offsets(reduction.coreToOriginal.size() + 1, 0);
+    std::vector<int> adjacency;
+    for (size_t i = 0; i < reduction.coreToOriginal.size(); i++) {
+        for (int u : graph.getNeighbors(reduction.coreToOriginal[i])) {
+            if (originalToCore[u] >= 0) {
+                adjacency.push_back(originalToCore[u]);
+            }
+        }
+        offsets[i + 1] = static_cast<int>(adjacency.size());
+    }
+    reduction.core = Graph(std::move(offsets), std::move(adjacency));
+    return reduction;
+}
+
+/**
+ * @brief Colorie le graphe complet à partir d'une coloration du noyau.
+ *
+ * Les noeuds du noyau reprennent leur couleur, puis les noeuds retirés sont coloriés dans l'ordre inverse du retrait :
+ * au moment de sa réinsertion, un noeud a moins de k voisins déjà coloriés et reçoit la première couleur absente de
+ * son voisinage. Les conflits du graphe complet sont donc exactement ceux du noyau.
+ *
+ * @param graph Le graphe complet, colorié par la fonction.
+ * @param reduction La réduction obtenue avec peelLowDegree.
+ * @param coreColoring La coloration du noyau.
+ * @param k Le nombre de couleur utilisable.
+ * @throw std::invalid_argument si coreColoring ne correspond pas au noyau.
+ */
+void reinsertPeeled(Graph& graph, const Reduction& reduction, const std::vector<int>& coreColoring, int k) {
+    if (coreColoring.size() != reduction.coreToOriginal.size()) {
+        throw std::invalid_argument("La coloration ne correspond pas au noyau de la réduction.");
+    }
+    std::vector<int> colors(graph.getNumNodes(), -1);
+    for (size_t i = 0; i < coreColoring.size(); i++) {
+        colors[reduction.coreToOriginal[i]] = coreColoring[i];
+    }
+
+    // Couleurs utilisées par les voisins du noeud courant, tampon réutilisé d'un noeud à l'autre
+    std::vector<bool> used(k, false);
+    for (auto it = reduction.removed.rbegin(); it != reduction.removed.rend(); ++it) {
+        int v = *it;
+        for (int u : graph.getNeighbors(v)) {
+            if (colors[u] >= 0 && colors[u] < k) {
+                used[colors[u]] = true;
+            }
+        }
+        int color = 0;
+        while (color < k - 1 && used[color]) {
+            color++;
+        }
+        colors[v] = color;
+        for (int u : graph.getNeighbors(v)) {
+            if (colors[u] >= 0 && colors[u] < k) {
+                used[colors[u]] = false;
+            }
+        }
+    }
+    graph.setColoring(colors);
+}
@@ -0,0 +1,280 @@
+/**
+ * @file HybridEvolution.cpp
+ * @brief Implémente l'algorithme évolutionnaire hybride (croisement GPX et recherche tabou) multi-thread.
+ */
+
+#include "../include/HybridEvolution.h"
+#include "../include/RoundBarrier.h"
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+/**
+ * @brief Constructeur de la classe HybridEvolution.
+ * @param graph Le graphe à colorier, sa coloration courante (si elle utilise les couleurs [0, k-1]) sert de
+ * premier individu.
+ * @param k Le nombre de couleur utilisable.
+ * @param populationSize Le nombre d'individus.
+ * @param numThreads Le nombre de threads (et d'enfants par génération).
+ * @param seed La graine du générateur aléatoire.
+ * @throw std::invalid_argument si populationSize < 2, si numThreads < 1 ou si k < 2.
+ */
+HybridEvolution::HybridEvolution(const Graph& graph, int k, int populationSize, int numThreads, unsigned seed)
+        : k(k), numNodes(graph.getNumNodes()), populationSize(populationSize), rng(seed) {
+    if (populationSize < 2) {
+        throw std::invalid_argument("La population doit contenir au moins 2 individus.");
+    }
+    if (numThreads < 1) {
+        throw std::invalid_argument("Le nombre de threads doit être au moins 1.");
+    }
+    if (k < 2) {
+        throw std::invalid_argument("Le nombre de couleurs doit être au moins 2.");
+    }
+
+    // Population initiale : la coloration du graphe si elle est utilisable, puis des colorations aléatoires
+    pool.resize(static_cast<size_t>(populationSize) * numNodes);
+    poolCost.assign(populationSize, 0);
+    std::vector<int> start = graph.getColoring();
+    bool startValid = std::all_of(start.begin(), start.end(), [k](int color) { return color >= 0 && color < k; });
+    std::uniform_int_distribution<int> colorDistribution(0, k - 1);
+    for (int i = 0; i < populationSize; i++) {
+        int* individual = &pool[static_cast<size_t>(i) * numNodes];
+        for (int v = 0; v < numNodes; v++) {
+            individual[v] = (i == 0 && startValid) ? start[v] : colorDistribution(rng);
+        }
+    }
+
+    for (int t = 0; t < numThreads; t++) {
+        auto worker = std::make_unique<Worker>();
+        worker->solution = Graph(graph.getTopology()); // La topologie est partagée entre les threads
+        worker->solution.setColoring(std::vector<int>(pool.begin(), pool.begin() + numNodes));
+        worker->rng.seed(rng());
+        worker->tabu = std::make_unique<TabuCol>(worker->solution, k, static_cast<unsigned>(worker->rng()));
+        worker->child.resize(numNodes);
+        worker->members.resize(2 * static_cast<size_t>(numNodes));
+        worker->classStart.resize(2 * static_cast<size_t>(k + 1));
+        worker->classSize.resize(2 * static_cast<size_t>(k));
+        worker->next.resize(k);
+        workers.push_back(std::move(worker));
+    }
+}
+
+/**
+ * @brief Construit un enfant par croisement GPX (greedy partition crossover).
+ *
+ * À l'étape l, le parent (l mod 2) transmet sa plus grande classe de couleur parmi les noeuds non encore attribués,
+ * qui reçoivent la couleur l dans l'enfant. Les noeuds restants après k étapes reçoivent une couleur aléatoire.
+ *
+ * @param parentA La coloration du premier parent.
+ * @param parentB La coloration du second parent.
+ * @param worker Le thread, l'enfant est écrit dans worker.child.
+ */
+void HybridEvolution::crossover(const int* parentA, const int* parentB, Worker& worker) const {
+    const int* parents[2] = {parentA, parentB};
+    std::vector<int>& child = worker.child;
+    std::fill(child.begin(), child.end(), -1);
+
+    // Tri des noeuds de chaque parent par couleur (tri par dénombrement)
+    for (int p = 0; p < 2; p++) {
+        int* start = &worker.classStart[static_cast<size_t>(p) * (k + 1)];
+        int* size = &worker.classSize[static_cast<size_t>(p) * k];
+        int* members = &worker.members[static_cast<size_t>(p) * numNodes];
+        std::fill(size, size + k, 0);
+        for (int v = 0; v < numNodes; v++) {
+            size[parents[p][v]]++;
+        }
+        start[0] = 0;
+        for (int c = 0; c < k; c++) {
+            start[c + 1] = start[c] + size[c];
+        }
+        std::copy(start, start + k, worker.next.begin());
+        for (int v = 0; v < numNodes; v++) {
+            members[worker.next[parents[p][v]]++] = v;
+        }
+    }
+
+    int* sizeA = &worker.classSize[0];
+    int* sizeB = &worker.classSize[k];
+    for (int l = 0; l < k; l++) {
+        int p = l % 2;
+        const int* start = &worker.classStart[static_cast<size_t>(p) * (k + 1)];
+        const int* size = &worker.classSize[static_cast<size_t>(p) * k];
+        const int* members = &worker.members[static_cast<size_t>(p) * numNodes];
+        int largest = static_cast<int>(std::max_element(size, size + k) - size);
+        if (size[largest] == 0) {
+            break; // Tous les noeuds sont attribués
+        }
+        for (int i = start[largest]; i < start[largest + 1]; i++) {
+            int v = members[i];
+            if (child[v] < 0) {
+                child[v] = l;
+                sizeA[parentA[v]]--;
+                sizeB[parentB[v]]--;
+            }
+        }
+    }
+
+    std::uniform_int_distribution<int> colorDistribution(0, k - 1);
+    for (int v = 0; v < numNodes; v++) {
+        if (child[v] < 0) {
+            child[v] = colorDistribution(worker.rng);
+        }
+    }
+}
+
+/**
+ * @brief Améliore worker.child par recherche tabou.
+ * @param worker Le thread.
+ * @param budget Le budget de la recherche tabou.
+ */
+void HybridEvolution::improve(Worker& worker, const RunBudget& budget) {
+    worker.tabu->reset(worker.child);
+    worker.childCost = worker.tabu->run(budget);
+    worker.child = worker.solution.getColoring();
+    const SearchStats& tabuStats = worker.tabu->getStats();
+    worker.stats.iterations += tabuStats.iterations;
+    worker.stats.acceptedMoves += tabuStats.acceptedMoves;
+    worker.stats.uphillMoves += tabuStats.uphillMoves;
+}
+
+/**
+ * @brief Lance l'algorithme évolutionnaire.
+ * @param childIter Le nombre d'itérations de la recherche tabou appliquée à chaque enfant.
+ * @param maxGenerations Le nombre maximum de générations.
+ * @param budget Le budget de l'algorithme (temps, coût cible, annulation), partagé par les recherches tabou.
+ * @return Le nombre de conflits de la meilleure coloration rencontrée, y compris si l'algorithme est interrompu.
+ */
+int HybridEvolution::run(long long childIter, long long maxGenerations, RunBudget budget) {
+    auto startTime = std::chrono::steady_clock::now();
+    auto elapsedSeconds = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    };
+    // Chaque recherche tabou partage l'échéance et le jeton de l'algorithme
+    RunBudget childBudget = budget.child(childIter);
+    int numThreads = static_cast<int>(workers.size());
+    stats = SearchStats();
+    generations = 0;
+    for (auto& worker : workers) {
+        worker->stats = SearchStats();
+    }
+
+    int bestCost = -1;
+    auto updateBest = [&](int individual) {
+        if (bestCost < 0 || poolCost[individual] < bestCost) {
+            bestCost = poolCost[individual];
+            auto first = pool.begin() + static_cast<std::ptrdiff_t>(individual) * numNodes;
+            bestColoring.assign(first, first + numNodes);
+            timeToBest = elapsedSeconds();
+            stats.recordBest(timeToBest, bestCost);
+        }
+    };
+
+    // Conditions d'arrêt, vérifiées avant chaque génération ; la génération suivante est comptée si elle a lieu
+    bool finished = false;
+    auto startNextGeneration = [&]() {
+        finished = bestCost <= budget.getTargetCost() || generations >= maxGenerations || budget.expired();
+        if (!finished) {
+            generations++;
+        }
+    };
+
+    // Fin de l'initialisation et fin de génération, exécutées par un seul thread
+    auto endOfInitialization = [&]() {
+        for (int i = 0; i < populationSize; i++) {
+            updateBest(i);
+        }
+        startNextGeneration();
+    };
+    auto endOfGeneration = [&]() {
+        // Remplacement du pire individu par chaque enfant qui n'est pas moins bon
+        for (auto& worker : workers) {
+            int worst = static_cast<int>(std::max_element(poolCost.begin(), poolCost.end()) - poolCost.begin());
+            if (worker->childCost <= poolCost[worst]) {
+                std::copy(worker->child.begin(), worker->child.end(),
+                          pool.begin() + static_cast<std::ptrdiff_t>(worst) * numNodes);
+                poolCost[worst] = worker->childCost;
+                updateBest(worst);
+            }
+        }
+        stats.sample(elapsedSeconds(), 0, bestCost);
+        startNextGeneration();
+    };
+
+    RoundBarrier barrier(numThreads);
+    auto work = [&](int t) {
+        Worker& worker = *workers[t];
+        // Amélioration de la population initiale, les individus étant répartis entre les threads
+        for (int i = t; i < populationSize; i += numThreads) {
+            auto first = pool.begin() + static_cast<std::ptrdiff_t>(i) * numNodes;
+            std::copy(first, first + numNodes, worker.child.begin());
+            improve(worker, childBudget);
+            std::copy(worker.child.begin(), worker.child.end(), first);
+            poolCost[i] = worker.childCost;
+        }
+        barrier.arriveAndWait(endOfInitialization);
+
+        // finished n'est modifié que par les actions de fin de tour, sous le verrou de la barrière
+        std::uniform_int_distribution<int> parentDistribution(0, populationSize - 1);
+        while (!finished) {
+            // Un enfant par thread : croisement de deux parents distincts puis recherche tabou
+            int a = parentDistribution(worker.rng);
+            int b = parentDistribution(worker.rng);
+            while (b == a) {
+                b = parentDistribution(worker.rng);
+            }
+            crossover(&pool[static_cast<size_t>(a) * numNodes], &pool[static_cast<size_t>(b) * numNodes], worker);
+            improve(worker, childBudget);
+            barrier.arriveAndWait(endOfGeneration);
+        }
+    };
+
+    // Les threads vivent pendant tout l'appel, sans en créer s'il n'y en a qu'un
+    if (numThreads == 1) {
+        work(0);
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (int t = 0; t < numThreads; t++) {
+            threads.emplace_back(work, t);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    for (auto& worker : workers) {
+        stats.iterations += worker->stats.iterations;
+        stats.acceptedMoves += worker->stats.acceptedMoves;
+        stats.uphillMoves += worker->stats.uphillMoves;
+    }
+    stats.elapsedSeconds = elapsedSeconds();
+    return bestCost;
+}
+
+/**
+ * @return La meilleure coloration rencontrée.
+ */
+const std::vector<int>& HybridEvolution::getBestColoring() const {
+    return bestColoring;
+}
+
+/**
+ * @return Le temps (en secondes) écoulé avant de trouver la meilleure coloration.
+ */
+double HybridEvolution::getTimeToBest() const {
+    return timeToBest;
+}
+
+/**
+ * @return Le nombre de générations effectuées lors du dernier appel à run.
+ */
+long long HybridEvolution::getGenerations() const {
+    return generations;
+}
+
+/**
+ * @return Les mesures du dernier appel à run.
+ */
+const SearchStats& HybridEvolution::getStats() const {
+    return stats;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file KempeChain.cpp
+ * @brief Implémente le calcul des chaînes de Kempe et l'échange de leurs couleurs.
+ */
+
+#include "../include/KempeChain.h"
+#include <algorithm>
+
+/**
+ * @brief Constructeur de la classe KempeChain.
+ * @param numNodes Le nombre de noeuds du graphe.
+ * @param firstGeneration La génération des marques avant la première chaîne (proche de UINT32_MAX, elle permet de
+ * vérifier le débordement du compteur).
+ */
+KempeChain::KempeChain(int numNodes, std::uint32_t firstGeneration) : mark(numNodes, 0), generation(firstGeneration) {
+    nodes.reserve(numNodes);
+}
+
+/**
+ * @brief Calcule la chaîne de Kempe d'un noeud vers une autre couleur et la variation du nombre de conflits de
+ * l'échange, sans modifier le graphe. La variation ne parcourt que les voisins des noeuds de la chaîne.
+ * @param graph Le graphe colorié.
+ * @param v L'ID du noeud de départ.
+ * @param otherColor La seconde couleur de la chaîne, différente de celle de v.
+ * @return La variation du nombre de conflits si les couleurs de la chaîne sont échangées.
+ */
+int KempeChain::build(const Graph& graph, int v, int otherColor) {
+    if (++generation == 0) {
+        // Débordement du compteur : les anciennes marques sont effacées une fois tous les 2^32 parcours
+        std::fill(mark.begin(), mark.end(), 0);
+        generation = 1;
+    }
+    colorA = graph.getColor(v);
+    colorB = otherColor;
+    nodes.clear();
+    nodes.push_back(v);
+    mark[v] = generation;
+
+    // Parcours en largeur le long des arêtes entre les couleurs a et b
+    for (size_t head = 0; head < nodes.size(); head++) {
+        int x = nodes[head];
+        int next = graph.getColor(x) == colorA ? colorB : colorA;
+        for (int u : graph.getNeighbors(x)) {
+            if (mark[u] != generation && graph.getColor(u) == next) {
+                mark[u] = generation;
+                nodes.push_back(u);
+            }
+        }
+    }
+
+    // Seules les arêtes entre la chaîne et le reste du graphe changent d'état
+    int delta = 0;
+    for (int x : nodes) {
+        int oldColor = graph.getColor(x);
+        int newColor = oldColor == colorA ? colorB : colorA;
+        for (int u : graph.getNeighbors(x)) {
+            if (mark[u] != generation) {
+                int color = graph.getColor(u);
+                delta += (color == newColor) - (color == oldColor);
+            }
+        }
+    }
+    return delta;
+}
+
+/**
+ * @brief Échange les deux couleurs sur les noeuds de la dernière chaîne calculée par build.
+ * @param graph Le graphe, dont la coloration n'a pas changé depuis build.
+ */
+void KempeChain::apply(Graph& graph) const {
+    for (int x : nodes) {
+        graph.recolorNode(x, graph.getColor(x) == colorA ? colorB : colorA);
+    }
+}
+
+/**
+ * @return Les noeuds de la dernière chaîne calculée par build.
+ */
+const std::vector<int>& KempeChain::getNodes() const {
+    return nodes;
+}
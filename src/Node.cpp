@@ -41,46 +41,24 @@ void Node::setColor(int c) {
 }
 
 /**
- * @brief Obtient la liste des ID des noeuds voisins.
- * @return Une référence constante vers la liste des ID des noeuds voisins.
- */
-[[nodiscard]] const std::list<int>& Node::getNeighbors() const {
-    return neighbors;
-}
-
-/**
- * @brief Ajoute un noeud voisin.
- * @param neighborID L'ID du noeud voisin à ajouter.
- */
-void Node::addNeighbor(int neighborID) {
-    neighbors.push_back(neighborID);
-}
-
-/**
- * @brief Crée une copie en profondeur du noeud.
- * @return Une nouvelle instance de Node copiée en profondeur.
+ * @brief Crée une copie du noeud.
+ * @return Une nouvelle instance de Node avec le même ID et la même couleur.
  */
 Node Node::clone(){
-    Node clonedNode(id); // Crée une nouvelle instance de Node avec le même ID.
-    clonedNode.color = color;
-    // Copie en profondeur de la liste des voisins.
-    for (int neighborID : neighbors) {
-        clonedNode.addNeighbor(neighborID);
-    }
-    return clonedNode;
+    return {id, color};
 }
 
 /**
  * @brief Compte les conflits avec les noeuds voisins.
+ * Les voisins sont lus dans la table d'adjacence du graphe.
  * @param g Le graphe sur lequel on travail
  * @return Le nombre de conflit.
  */
 int Node::countConflict(const Graph& g) const {
     int conflictCount = 0;
     int nodeColor = getColor();
-    for (int neighborID : neighbors) {
-        const Node& neighbor = g.getNode(neighborID);
-        if (neighbor.getColor() == nodeColor) {
+    for (int neighborID : g.getNeighbors(id)) {
+        if (g.getColor(neighborID) == nodeColor) {
             conflictCount++;
         }
     }
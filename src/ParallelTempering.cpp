@@ -0,0 +1,242 @@
+/**
+ * @file ParallelTempering.cpp
+ * @brief Implémente l'échange de répliques (parallel tempering) multi-thread.
+ */
+
+#include "../include/ParallelTempering.h"
+#include "../include/RoundBarrier.h"
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+/**
+ * @brief Constructeur de la classe ParallelTempering.
+ * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale à chaque réplique.
+ * @param k Le nombre de couleur utilisable.
+ * @param numReplicas Le nombre de répliques (et de threads).
+ * @param minTemp La température la plus basse de l'échelle.
+ * @param maxTemp La température la plus haute de l'échelle.
+ * @param seed La graine du générateur aléatoire.
+ * @throw std::invalid_argument si numReplicas < 2, si les températures sont invalides ou si k < 2.
+ */
+ParallelTempering::ParallelTempering(const Graph& graph, int k, int numReplicas, double minTemp, double maxTemp,
+                                     unsigned seed)
+        : k(k), exchangeRng(seed), solved(false) {
+    if (numReplicas < 2) {
+        throw std::invalid_argument("L'échange de répliques nécessite au moins 2 répliques.");
+    }
+    if (minTemp <= 0 || maxTemp < minTemp) {
+        throw std::invalid_argument("L'échelle de températures doit vérifier 0 < minTemp <= maxTemp.");
+    }
+    if (k < 2) {
+        throw std::invalid_argument("Le nombre de couleurs doit être au moins 2.");
+    }
+
+    // Échelle géométrique entre minTemp et maxTemp
+    double ratio = std::pow(maxTemp / minTemp, 1.0 / (numReplicas - 1));
+    for (int p = 0; p < numReplicas; p++) {
+        ladder.push_back(minTemp * std::pow(ratio, p));
+        replicaAt.push_back(p);
+    }
+
+    Graph start = graph;
+    start.setConflictCount();
+    int startCost = start.countConflicts();
+    bestColoring = start.getColoring();
+    replicas.resize(numReplicas);
+    for (int r = 0; r < numReplicas; r++) {
+        Replica& replica = replicas[r];
+        replica.solution = start.clone();
+        replica.stream = RandomStream<Xoshiro256>(exchangeRng());
+        replica.cost = startCost;
+        replica.temperature = ladder[r];
+        replica.acceptance.setTemperature(ladder[r]);
+        replica.bestColoring = bestColoring;
+        replica.bestCost = startCost;
+        replica.stats.recordBest(0, startCost);
+    }
+}
+
+/**
+ * @brief Effectue numMoves mouvements de Metropolis sur une réplique à sa température courante.
+ * @param replica La réplique.
+ * @param numMoves Le nombre de mouvements.
+ * @param elapsed Le temps écoulé depuis le début au début du tour.
+ */
+void ParallelTempering::sweep(Replica& replica, int numMoves, double elapsed) {
+    Graph& solution = replica.solution;
+    int numNodes = solution.getNumNodes();
+
+    for (int i = 0; i < numMoves; i++) {
+        if (solved.load(std::memory_order_relaxed)) {
+            return;
+        }
+        replica.moves++;
+        int nodeID = replica.stream.below(numNodes);
+        int currentColor = solution.getColor(nodeID);
+        int newColor = replica.stream.below(k - 1);
+        if (newColor >= currentColor) {
+            newColor++;
+        }
+        int delta = solution.recolorDelta(nodeID, newColor);
+        if (!replica.acceptance.accept(delta, replica.stream)) {
+            continue;
+        }
+        solution.recolorNode(nodeID, newColor);
+        replica.cost += delta;
+        replica.stats.acceptedMoves++;
+        if (delta > 0) {
+            replica.stats.uphillMoves++;
+        }
+        if (replica.cost < replica.bestCost) {
+            replica.bestCost = replica.cost;
+            replica.bestColoring = solution.getColoring();
+            replica.bestTime = elapsed;
+            replica.stats.recordBest(elapsed, replica.cost);
+            if (replica.cost <= targetCost) {
+                solved.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tente les échanges de températures entre répliques voisines sur l'échelle.
+ * @param round Le numéro du tour (détermine la parité des paires).
+ */
+void ParallelTempering::exchange(long long round) {
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    for (int p = static_cast<int>(round % 2); p + 1 < static_cast<int>(ladder.size()); p += 2) {
+        Replica& cold = replicas[replicaAt[p]];
+        Replica& hot = replicas[replicaAt[p + 1]];
+        double exponent = (1.0 / ladder[p] - 1.0 / ladder[p + 1]) * (cold.cost - hot.cost);
+        swapAttempts++;
+        if (exponent >= 0 || distribution(exchangeRng) < std::exp(exponent)) {
+            std::swap(replicaAt[p], replicaAt[p + 1]);
+            cold.temperature = ladder[p + 1];
+            hot.temperature = ladder[p];
+            cold.acceptance.setTemperature(cold.temperature);
+            hot.acceptance.setTemperature(hot.temperature);
+            swapAccepted++;
+        }
+    }
+}
+
+/**
+ * @brief Lance l'échange de répliques.
+ * @param exchangeInterval Le nombre de mouvements de chaque réplique entre deux tentatives d'échange.
+ * @param maxRounds Le nombre maximum de tours.
+ * @param budget Le budget de l'échange (temps, coût cible, annulation), vérifié à la fin de chaque tour.
+ * @return Le nombre de conflits de la meilleure coloration rencontrée, y compris si l'échange est interrompu.
+ */
+int ParallelTempering::run(int exchangeInterval, long long maxRounds, RunBudget budget) {
+    if (exchangeInterval < 1) {
+        throw std::invalid_argument("L'intervalle d'échange doit être au moins 1.");
+    }
+    int numReplicas = static_cast<int>(replicas.size());
+    auto startTime = std::chrono::steady_clock::now();
+    RoundBarrier barrier(numReplicas);
+    long long round = 0;
+    targetCost = budget.getTargetCost();
+    bool finished = replicas[0].cost <= targetCost || maxRounds <= 0;
+    double elapsed = 0;
+
+    // Fin de tour : échanges et conditions d'arrêt, exécutés par un seul thread
+    auto endOfRound = [&]() {
+        round++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        if (solved.load() || round >= maxRounds || budget.expired()) {
+            finished = true;
+            return;
+        }
+        exchange(round);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numReplicas);
+    for (int r = 0; r < numReplicas; r++) {
+        threads.emplace_back([&, r]() {
+            // finished et elapsed ne sont modifiés que par endOfRound, sous le verrou de la barrière
+            while (!finished) {
+                // Un échantillon par tour pour la réplique la plus froide
+                if (replicaAt[0] == r) {
+                    replicas[r].stats.sample(elapsed, replicas[r].temperature, replicas[r].cost);
+                }
+                sweep(replicas[r], exchangeInterval, elapsed);
+                barrier.arriveAndWait(endOfRound);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Meilleure coloration toutes répliques confondues
+    int bestCost = replicas[0].bestCost;
+    int bestReplica = 0;
+    for (int r = 1; r < numReplicas; r++) {
+        if (replicas[r].bestCost < bestCost) {
+            bestCost = replicas[r].bestCost;
+            bestReplica = r;
+        }
+    }
+    bestColoring = replicas[bestReplica].bestColoring;
+    timeToBest = replicas[bestReplica].bestTime;
+
+    double totalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::vector<SearchStats> replicaStats;
+    for (Replica& replica : replicas) {
+        replica.stats.iterations = replica.moves;
+        replica.stats.elapsedSeconds = totalTime;
+        replicaStats.push_back(replica.stats);
+    }
+    stats = mergeParallelStats(replicaStats);
+    return bestCost;
+}
+
+/**
+ * @return La meilleure coloration rencontrée.
+ */
+const std::vector<int>& ParallelTempering::getBestColoring() const {
+    return bestColoring;
+}
+
+/**
+ * @return Le temps (en secondes) écoulé avant de trouver la meilleure coloration.
+ */
+double ParallelTempering::getTimeToBest() const {
+    return timeToBest;
+}
+
+/**
+ * @return Le nombre total de mouvements évalués par toutes les répliques.
+ */
+long long ParallelTempering::getMoves() const {
+    long long moves = 0;
+    for (const Replica& replica : replicas) {
+        moves += replica.moves;
+    }
+    return moves;
+}
+
+/**
+ * @return Le nombre d'échanges tentés.
+ */
+long long ParallelTempering::getSwapAttempts() const {
+    return swapAttempts;
+}
+
+/**
+ * @return Le nombre d'échanges acceptés.
+ */
+long long ParallelTempering::getSwapAccepted() const {
+    return swapAccepted;
+}
+
+/**
+ * @return Les mesures du dernier appel à run (répliques fusionnées).
+ */
+const SearchStats& ParallelTempering::getStats() const {
+    return stats;
+}
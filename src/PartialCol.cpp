@@ -0,0 +1,259 @@
+/**
+ * @file PartialCol.cpp
+ * @brief Implémente la recherche tabou PartialCol sur les k-colorations partielles légales.
+ */
+
+#include "../include/PartialCol.h"
+#include <chrono>
+#include <algorithm>
+
+namespace {
+    // Partie aléatoire de la durée tabou : tirage uniforme dans [0, TENURE_RANDOM - 1].
+    constexpr int TENURE_RANDOM = 10;
+    // Coefficient appliqué au nombre de noeuds non coloriés dans la durée tabou.
+    constexpr double TENURE_ALPHA = 0.6;
+    // Longueur (en itérations) de la fenêtre d'observation de la fluctuation du coût.
+    constexpr long long REACTIVE_PERIOD = 1000;
+    // Fluctuation (coût max - coût min sur la fenêtre) en dessous de laquelle la recherche est jugée bloquée.
+    constexpr int REACTIVE_THRESHOLD = 2;
+    // Allongement maximal de la durée tabou.
+    constexpr int REACTIVE_MAX_BONUS = 10;
+}
+
+/**
+ * @brief Constructeur de la classe PartialCol.
+ * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale.
+ * @param k Le nombre de couleur utilisable.
+ * @param seed La graine du générateur aléatoire.
+ * @throw std::invalid_argument si k est inférieur à 1 ou si un noeud a une couleur hors de [0, k-1].
+ */
+PartialCol::PartialCol(Graph& graph, int k, unsigned seed)
+        : graph(graph), k(k), numNodes(graph.getNumNodes()), rng(seed), bestUncolored(0), iterations(0) {
+    if (k < 1) {
+        throw std::invalid_argument("Le nombre de couleurs doit être au moins 1.");
+    }
+    reset(graph.getColoring());
+}
+
+/**
+ * @brief Remplace la solution initiale sans réallouer les tables. Les noeuds en conflit sont retirés un à un
+ * (dans l'ordre des ID) jusqu'à obtenir une coloration partielle légale.
+ * @param coloring La nouvelle solution initiale, une couleur par noeud.
+ * @throw std::invalid_argument si la taille ne correspond pas au graphe ou si une couleur est hors de [0, k-1].
+ */
+void PartialCol::reset(const std::vector<int>& coloring) {
+    if (static_cast<int>(coloring.size()) != numNodes) {
+        throw std::invalid_argument("La coloration initiale doit contenir une couleur par noeud.");
+    }
+    for (int color : coloring) {
+        if (color < 0 || color >= k) {
+            throw std::invalid_argument("La coloration initiale doit utiliser des couleurs dans [0, k-1].");
+        }
+    }
+    colors = coloring;
+
+    adjacentColors.assign(static_cast<size_t>(numNodes) * k, 0);
+    for (int v = 0; v < numNodes; v++) {
+        for (int u : graph.getNeighbors(v)) {
+            adjacentColors[static_cast<size_t>(v) * k + colors[u]]++;
+        }
+    }
+    tabuUntil.assign(static_cast<size_t>(numNodes) * k, 0);
+    uncolored.clear();
+    uncoloredPos.assign(numNodes, -1);
+
+    // Un noeud encore en conflit lors de son passage est retiré : les compteurs ne font que diminuer, chaque noeud
+    // resté colorié n'a donc plus de voisin de sa couleur à la fin du parcours
+    for (int v = 0; v < numNodes; v++) {
+        if (adjacentColors[static_cast<size_t>(v) * k + colors[v]] > 0) {
+            uncolorNode(v);
+        }
+    }
+}
+
+/**
+ * @brief Colorie un noeud non colorié et met à jour la table des couleurs adjacentes.
+ * @param v L'ID du noeud.
+ * @param color La couleur.
+ */
+void PartialCol::colorNode(int v, int color) {
+    colors[v] = color;
+    for (int u : graph.getNeighbors(v)) {
+        adjacentColors[static_cast<size_t>(u) * k + color]++;
+    }
+    // Retrait en O(1) : le dernier élément prend la place du noeud colorié
+    int last = uncolored.back();
+    uncolored[uncoloredPos[v]] = last;
+    uncoloredPos[last] = uncoloredPos[v];
+    uncolored.pop_back();
+    uncoloredPos[v] = -1;
+}
+
+/**
+ * @brief Retire la couleur d'un noeud, qui rejoint l'ensemble des noeuds non coloriés.
+ * @param v L'ID du noeud.
+ */
+void PartialCol::uncolorNode(int v) {
+    int color = colors[v];
+    colors[v] = UNCOLORED;
+    for (int u : graph.getNeighbors(v)) {
+        adjacentColors[static_cast<size_t>(u) * k + color]--;
+    }
+    uncoloredPos[v] = static_cast<int>(uncolored.size());
+    uncolored.push_back(v);
+}
+
+/**
+ * @brief Lance la recherche tabou puis applique au graphe la meilleure coloration partielle rencontrée, y compris
+ * si la recherche est interrompue : chaque noeud non colorié reçoit la couleur qui provoque le moins de conflits.
+ * @param budget Le budget de la recherche (temps, itérations, annulation), le coût cible porte sur le nombre de
+ * noeuds non coloriés.
+ * @return Le nombre de conflits de la coloration appliquée au graphe.
+ */
+int PartialCol::run(RunBudget budget) {
+    bestColors = colors;
+    bestUncolored = static_cast<int>(uncolored.size());
+    int reactiveBonus = 0;
+    int windowMin = bestUncolored;
+    int windowMax = bestUncolored;
+    std::uniform_int_distribution<int> tenureDistribution(0, TENURE_RANDOM - 1);
+    auto startTime = std::chrono::steady_clock::now();
+    stats = SearchStats();
+    stats.recordBest(0, bestUncolored);
+
+    iterations = 0;
+    while (!uncolored.empty() && !budget.shouldStop(iterations, bestUncolored)) {
+        iterations++;
+        int cost = static_cast<int>(uncolored.size());
+
+        // Recherche du meilleur mouvement autorisé : le noeud v est colorié, ses voisins de couleur c sont retirés
+        int bestDelta = 0;
+        int bestNode = -1;
+        int bestColor = -1;
+        int ties = 0;
+        for (int v : uncolored) {
+            const int* row = &adjacentColors[static_cast<size_t>(v) * k];
+            const long long* tabuRow = &tabuUntil[static_cast<size_t>(v) * k];
+            for (int c = 0; c < k; c++) {
+                int delta = row[c] - 1;
+                // Un mouvement tabou n'est autorisé que s'il améliore la meilleure solution (aspiration)
+                if (tabuRow[c] >= iterations && cost + delta >= bestUncolored) {
+                    continue;
+                }
+                if (bestNode < 0 || delta < bestDelta) {
+                    bestDelta = delta;
+                    bestNode = v;
+                    bestColor = c;
+                    ties = 1;
+                } else if (delta == bestDelta) {
+                    // Choix uniforme parmi les meilleurs mouvements
+                    ties++;
+                    if (std::uniform_int_distribution<int>(0, ties - 1)(rng) == 0) {
+                        bestNode = v;
+                        bestColor = c;
+                    }
+                }
+            }
+        }
+
+        if (bestNode < 0) {
+            // Tous les mouvements sont tabous : mouvement aléatoire sur un noeud non colorié
+            bestNode = uncolored[std::uniform_int_distribution<int>(0, cost - 1)(rng)];
+            bestColor = std::uniform_int_distribution<int>(0, k - 1)(rng);
+            bestDelta = adjacentColors[static_cast<size_t>(bestNode) * k + bestColor] - 1;
+        }
+        if (bestDelta > 0) {
+            stats.uphillMoves++;
+        }
+
+        // Durée tabou dynamique et réactive : allongée si le coût stagne sur la fenêtre, raccourcie sinon
+        cost += bestDelta;
+        windowMin = std::min(windowMin, cost);
+        windowMax = std::max(windowMax, cost);
+        if (iterations % REACTIVE_PERIOD == 0) {
+            if (windowMax - windowMin < REACTIVE_THRESHOLD) {
+                reactiveBonus = std::min(reactiveBonus + 1, REACTIVE_MAX_BONUS);
+            } else if (reactiveBonus > 0) {
+                reactiveBonus--;
+            }
+            windowMin = cost;
+            windowMax = cost;
+        }
+        long long tenure = tenureDistribution(rng) + static_cast<long long>(TENURE_ALPHA * static_cast<double>(cost))
+                           + reactiveBonus;
+
+        // Les voisins de couleur bestColor sont retirés et ne peuvent pas la reprendre pendant la durée tabou
+        if (adjacentColors[static_cast<size_t>(bestNode) * k + bestColor] > 0) {
+            for (int u : graph.getNeighbors(bestNode)) {
+                if (colors[u] == bestColor) {
+                    uncolorNode(u);
+                    tabuUntil[static_cast<size_t>(u) * k + bestColor] = iterations + tenure;
+                }
+            }
+        }
+        colorNode(bestNode, bestColor);
+
+        if (cost < bestUncolored) {
+            bestUncolored = cost;
+            bestColors = colors;
+            stats.recordBest(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count(),
+                             bestUncolored);
+        }
+
+        if (iterations % SearchStats::SAMPLE_PERIOD == 0) {
+            stats.sample(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count(), 0, cost);
+        }
+    }
+
+    stats.iterations = iterations;
+    stats.acceptedMoves = iterations; // Chaque itération applique un mouvement
+    stats.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Complétion de la meilleure coloration partielle : couleur qui provoque le moins de conflits
+    std::vector<int> coloring = bestColors;
+    std::vector<int> neighborColors(k);
+    for (int v = 0; v < numNodes; v++) {
+        if (coloring[v] != UNCOLORED) {
+            continue;
+        }
+        std::fill(neighborColors.begin(), neighborColors.end(), 0);
+        for (int u : graph.getNeighbors(v)) {
+            if (coloring[u] != UNCOLORED) {
+                neighborColors[coloring[u]]++;
+            }
+        }
+        coloring[v] = static_cast<int>(std::min_element(neighborColors.begin(), neighborColors.end())
+                                       - neighborColors.begin());
+    }
+    graph.setColoring(coloring);
+    return graph.countConflicts();
+}
+
+/**
+ * @return Le nombre d'itérations effectuées lors du dernier appel à run.
+ */
+long long PartialCol::getIterations() const {
+    return iterations;
+}
+
+/**
+ * @return Le nombre de noeuds non coloriés de la meilleure coloration partielle du dernier appel à run.
+ */
+int PartialCol::getBestUncolored() const {
+    return bestUncolored;
+}
+
+/**
+ * @return La meilleure coloration partielle du dernier appel à run, avant sa complétion (UNCOLORED pour les noeuds
+ * non coloriés).
+ */
+const std::vector<int>& PartialCol::getBestPartialColoring() const {
+    return bestColors;
+}
+
+/**
+ * @return Les mesures du dernier appel à run, dont le coût est le nombre de noeuds non coloriés.
+ */
+const SearchStats& PartialCol::getStats() const {
+    return stats;
+}
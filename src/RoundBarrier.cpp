@@ -0,0 +1,29 @@
+/**
+ * @file RoundBarrier.cpp
+ * @brief Implémente la barrière réutilisable RoundBarrier.
+ */
+
+#include "../include/RoundBarrier.h"
+
+/**
+ * @brief Constructeur de la classe RoundBarrier.
+ * @param count Le nombre de threads attendus à chaque tour.
+ */
+RoundBarrier::RoundBarrier(int count) : count(count), waiting(0), generation(0) {}
+
+/**
+ * @brief Attend que tous les threads soient arrivés.
+ * @param completion L'action exécutée une seule fois par le dernier thread arrivé.
+ */
+void RoundBarrier::arriveAndWait(const std::function<void()>& completion) {
+    std::unique_lock<std::mutex> lock(mutex);
+    long long arrivalGeneration = generation;
+    if (++waiting == count) {
+        completion();
+        waiting = 0;
+        generation++;
+        condition.notify_all();
+    } else {
+        condition.wait(lock, [&] { return generation != arrivalGeneration; });
+    }
+}
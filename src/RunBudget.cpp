@@ -0,0 +1,146 @@
+/**
+ * @file RunBudget.cpp
+ * @brief Implémente le budget d'une recherche et l'interruption par SIGINT/SIGTERM.
+ */
+
+#include "../include/RunBudget.h"
+#include <csignal>
+
+/**
+ * @brief Constructeur de la classe RunBudget, le temps est décompté à partir de la construction.
+ * @param maxSeconds Le temps maximum en secondes.
+ * @param maxIterations Le nombre maximum d'itérations.
+ * @param targetCost Le coût à partir duquel la recherche s'arrête.
+ * @param token Le jeton d'annulation, nul si la recherche ne peut pas être annulée.
+ */
+RunBudget::RunBudget(double maxSeconds, long long maxIterations, int targetCost, const CancellationToken* token)
+        : start(std::chrono::steady_clock::now()), maxSeconds(maxSeconds), maxIterations(maxIterations),
+          targetCost(targetCost), token(token) {}
+
+/**
+ * @brief Crée un budget dérivé qui partage l'échéance, le coût cible et le jeton de ce budget.
+ * @param maxIterations Le nombre maximum d'itérations du budget dérivé, négatif pour conserver celui de ce budget.
+ * @param token Le jeton du budget dérivé, nul pour conserver celui de ce budget.
+ * @return Le budget dérivé.
+ */
+RunBudget RunBudget::child(long long maxIterations, const CancellationToken* token) const {
+    RunBudget derived = *this;
+    if (maxIterations >= 0) {
+        derived.maxIterations = maxIterations;
+    }
+    if (token != nullptr) {
+        derived.token = token;
+    }
+    derived.countdown = CHECK_PERIOD;
+    derived.stopReason = StopReason::None;
+    return derived;
+}
+
+/**
+ * @brief Teste immédiatement l'échéance et le jeton d'annulation (boucles à gros grain).
+ * @return true si le temps est écoulé ou si la recherche est annulée.
+ */
+bool RunBudget::expired() {
+    if (cancelled()) {
+        stopReason = StopReason::Cancelled;
+        return true;
+    }
+    if (elapsedSeconds() >= maxSeconds) {
+        stopReason = StopReason::Time;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @return Le temps écoulé en secondes depuis la construction du budget racine.
+ */
+double RunBudget::elapsedSeconds() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @return Le temps restant en secondes avant l'échéance (infini si aucune).
+ */
+double RunBudget::remainingSeconds() const {
+    double remaining = maxSeconds - elapsedSeconds();
+    return remaining > 0 ? remaining : 0.0;
+}
+
+/**
+ * @return true si le jeton d'annulation a été annulé.
+ */
+bool RunBudget::cancelled() const {
+    return token != nullptr && token->isCancelled();
+}
+
+/**
+ * @return Le coût à partir duquel la recherche s'arrête.
+ */
+int RunBudget::getTargetCost() const {
+    return targetCost;
+}
+
+/**
+ * @return Le jeton d'annulation, nul si aucun.
+ */
+const CancellationToken* RunBudget::getToken() const {
+    return token;
+}
+
+/**
+ * @return La raison du dernier arrêt signalé, StopReason::None si aucun.
+ */
+StopReason RunBudget::reason() const {
+    return stopReason;
+}
+
+/**
+ * @return Le jeton annulé à la réception de SIGINT ou SIGTERM, parent des jetons de toutes les recherches.
+ */
+CancellationToken& interruptToken() {
+    static CancellationToken token;
+    return token;
+}
+
+namespace {
+    /**
+     * @brief Gestionnaire de SIGINT et SIGTERM : annule interruptToken() et rétablit le comportement par défaut
+     * pour qu'un second signal termine le processus. N'utilise que des opérations autorisées dans un gestionnaire.
+     * @param signal Le signal reçu.
+     */
+    void handleInterrupt(int signal) {
+        interruptToken().cancel();
+        std::signal(signal, SIG_DFL);
+    }
+}
+
+/**
+ * @brief Installe les gestionnaires de SIGINT et SIGTERM : le premier signal annule interruptToken() (les
+ * algorithmes rendent alors leur meilleure solution), un second signal termine le processus.
+ */
+void installInterruptHandler() {
+    static_assert(std::atomic<bool>::is_always_lock_free, "Atomique sans verrou requis par le gestionnaire de signal.");
+    interruptToken(); // Construction du jeton avant la réception d'un signal
+    std::signal(SIGINT, handleInterrupt);
+    std::signal(SIGTERM, handleInterrupt);
+}
+
+/**
+ * @param reason La raison d'un arrêt.
+ * @return Le nom de la raison ("target", "iterations", "time", "cancelled" ou "none").
+ */
+const char* stopReasonName(StopReason reason) {
+    switch (reason) {
+        case StopReason::Target:
+            return "target";
+        case StopReason::Iterations:
+            return "iterations";
+        case StopReason::Time:
+            return "time";
+        case StopReason::Cancelled:
+            return "cancelled";
+        default:
+            return "none";
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file SearchStats.cpp
+ * @brief Implémente la fusion des mesures de recherches parallèles, l'export CSV des échantillons et la mesure du
+ * pic de mémoire résidente.
+ */
+
+#include "../include/SearchStats.h"
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @brief Fusionne les mesures de recherches exécutées en parallèle depuis le même instant.
+ * Les compteurs sont additionnés, la trace conserve, au cours du temps, le meilleur coût toutes recherches
+ * confondues et les échantillons de toutes les recherches sont triés par temps, puis éclaircis jusqu'à MAX_SAMPLES.
+ * @param parallel Les mesures des recherches parallèles.
+ * @return Les mesures fusionnées.
+ */
+SearchStats mergeParallelStats(const std::vector<SearchStats>& parallel) {
+    SearchStats merged;
+    std::vector<std::pair<double, int>> points;
+    for (const SearchStats& stats : parallel) {
+        merged.iterations += stats.iterations;
+        merged.acceptedMoves += stats.acceptedMoves;
+        merged.uphillMoves += stats.uphillMoves;
+        merged.elapsedSeconds = std::max(merged.elapsedSeconds, stats.elapsedSeconds);
+        points.insert(points.end(), stats.bestTrace.begin(), stats.bestTrace.end());
+        merged.samples.insert(merged.samples.end(), stats.samples.begin(), stats.samples.end());
+    }
+    std::stable_sort(merged.samples.begin(), merged.samples.end(), [](const TraceSample& a, const TraceSample& b) {
+        return a.time < b.time;
+    });
+    while (merged.samples.size() > SearchStats::MAX_SAMPLES) {
+        merged.thinSamples();
+    }
+    std::sort(points.begin(), points.end());
+    for (const auto& [time, cost] : points) {
+        if (merged.bestTrace.empty() || cost < merged.bestTrace.back().second) {
+            merged.recordBest(time, cost);
+        }
+    }
+    return merged;
+}
+
+/**
+ * @brief Obtient le pic de mémoire résidente du processus.
+ * @return Le pic de mémoire résidente en kilo-octets, -1 si la mesure n'est pas disponible.
+ */
+long peakResidentMemoryKb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return -1;
+#else
+    struct rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#if defined(__APPLE__)
+    return static_cast<long>(usage.ru_maxrss / 1024); // Octets sous macOS
+#else
+    return static_cast<long>(usage.ru_maxrss); // Kilo-octets sous Linux
+#endif
+#endif
+}
+
+/**
+ * @brief Écrit les échantillons de la trajectoire au format CSV (time,temperature,cost), précédés d'une ligne d'en-tête.
+ * @param out Le flux de sortie.
+ * @param stats Les mesures de la recherche.
+ */
+void writeTraceCsv(std::ostream& out, const SearchStats& stats) {
+    out << "time,temperature,cost\n";
+    for (const TraceSample& point : stats.samples) {
+        out << point.time << "," << point.temperature << "," << point.cost << "\n";
+    }
+}
@@ -0,0 +1,313 @@
+/**
+ * @file SimulatedAnnealing.cpp
+ * @brief Implémente le recuit simulé (une trajectoire ou plusieurs en parallèle) et la recherche locale.
+ */
+
+#include "../include/SimulatedAnnealing.h"
+#include "../include/KempeChain.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Une trajectoire du recuit simulé, appliquée en place sur currentSol.
+ *
+ * Instancie le noyau annealingKernel avec le générateur choisi, le refroidissement géométrique (la température est
+ * multipliée par coolingRate toutes les 10 itérations) et le mouvement de recoloration, mélangé aux échanges de
+ * chaînes de Kempe si kempeRate > 0.
+ *
+ * @param currentSol La solution courante, modifiée en place.
+ * @param k Le nombre de couleur utilisable.
+ * @param initTemp La température initiale.
+ * @param coolingRate Le coefficient de refroidissement.
+ * @param nb_changes Nombre de changement de couleur dans le voisinage.
+ * @param kempeRate La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+ * @param budget Le budget de la trajectoire (temps, itérations, coût cible, annulation).
+ * @param seed La graine du générateur aléatoire.
+ * @param onTarget Jeton annulé par la trajectoire lorsqu'elle atteint le coût cible. Peut être nul.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param engine Le générateur aléatoire : "xoshiro" (xoshiro256**) ou "mt19937".
+ * @param source Le fichier source du graphe et la renumérotation de ses noeuds, comparés à ceux du point de reprise.
+ * @param resume Le point de reprise à partir duquel la trajectoire continue, nul pour partir de currentSol.
+ * @param checkpoints Le thread d'écriture des points de reprise, nul pour ne pas en écrire.
+ * @return Le résultat de la trajectoire.
+ * @throw std::invalid_argument si le point de reprise ne correspond pas au graphe (nombre de noeuds et d'arêtes,
+ * fichier source, renumérotation) ou aux paramètres de la trajectoire (k, générateur, initTemp, coolingRate,
+ * nb_changes, kempeRate, conflictSampling).
+ */
+AnnealingResult annealingRun(Graph& currentSol, int k, double initTemp, double coolingRate, int nb_changes,
+                             double kempeRate, const RunBudget& budget, unsigned seed, CancellationToken* onTarget,
+                             bool conflictSampling, const std::string& engine, const GraphSource& source,
+                             const AnnealingCheckpoint* resume, CheckpointWriter* checkpoints) {
+    if (resume != nullptr) {
+        // Reprendre avec d'autres paramètres continuerait silencieusement une autre trajectoire
+        const char* mismatch = nullptr;
+        if (static_cast<int>(resume->currentColoring.size()) != currentSol.getNumNodes()) {
+            mismatch = "le nombre de noeuds";
+        } else if (resume->numEdges != currentSol.getNumEdges()) {
+            mismatch = "le nombre d'arêtes";
+        } else if (resume->source.size != source.size || resume->source.time != source.time) {
+            mismatch = "le fichier du graphe";
+        } else if (resume->source.ordering != source.ordering) {
+            mismatch = "la renumérotation des noeuds";
+        } else if (resume->k != k) {
+            mismatch = "k";
+        } else if (resume->engine != engine) {
+            mismatch = "le générateur";
+        } else if (resume->initTemp != initTemp) {
+            mismatch = "la température initiale";
+        } else if (resume->coolingRate != coolingRate) {
+            mismatch = "le coefficient de refroidissement";
+        } else if (resume->nbChanges != nb_changes) {
+            mismatch = "le nombre de changements";
+        } else if (resume->kempeRate != kempeRate) {
+            mismatch = "la probabilité des chaînes de Kempe";
+        } else if (resume->conflictSampling != conflictSampling) {
+            mismatch = "le tirage des noeuds en conflit";
+        }
+        if (mismatch != nullptr) {
+            throw std::invalid_argument(std::string("Le point de reprise ne correspond pas aux paramètres de la "
+                                                    "trajectoire : ") + mismatch + " diffère.");
+        }
+    }
+    if (k < 2 || currentSol.getNumNodes() == 0 || nb_changes <= 0) {
+        // Aucun voisin possible
+        AnnealingResult result;
+        result.bestColoring = currentSol.getColoring();
+        result.bestCost = currentSol.countConflicts();
+        result.stats.recordBest(0, result.bestCost);
+        result.finalTemperature = initTemp;
+        return result;
+    }
+    GeometricCooling cooling(initTemp, coolingRate);
+    if (kempeRate > 0) {
+        KempeMove move(k, currentSol.getNumNodes(), nb_changes, conflictSampling, kempeRate);
+        if (engine == "mt19937") {
+            return annealingKernel<std::mt19937>(currentSol, cooling, move, budget, seed, onTarget, resume,
+                                                 checkpoints);
+        }
+        return annealingKernel<Xoshiro256>(currentSol, cooling, move, budget, seed, onTarget, resume, checkpoints);
+    }
+    RecolorMove move(k, nb_changes, conflictSampling);
+    if (engine == "mt19937") {
+        return annealingKernel<std::mt19937>(currentSol, cooling, move, budget, seed, onTarget, resume, checkpoints);
+    }
+    return annealingKernel<Xoshiro256>(currentSol, cooling, move, budget, seed, onTarget, resume, checkpoints);
+}
+
+/**
+ * @brief Algorithme du récuit simulé.
+ * @param graph Graphe à colorier.
+ * @param k Le nombre de couleur utilisable.
+ * @param initTemp La température initiale.
+ * @param coolingRate Le coefficient de refroidissement.
+ * @param nb_changes Nombre de changement de couleur dans le voisinage.
+ * @param kempeRate La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+ * @param budget Le budget de la recherche (temps, itérations, coût cible, annulation).
+ * @param seed La graine du générateur aléatoire.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param engine Le générateur aléatoire : "xoshiro" (xoshiro256**) ou "mt19937".
+ * @param source Le fichier source du graphe et la renumérotation de ses noeuds, comparés à ceux du point de reprise.
+ * @param resume Le point de reprise à partir duquel la recherche continue, nul pour partir de la coloration du graphe.
+ * @param checkpoints Le thread d'écriture des points de reprise, nul pour ne pas en écrire.
+ * @return Le résultat de la recherche, dont la meilleure coloration rencontrée (y compris si la recherche est
+ * interrompue). Le graphe n'est pas modifié.
+ * @throw std::invalid_argument si le point de reprise ne correspond pas au graphe (nombre de noeuds et d'arêtes,
+ * fichier source, renumérotation) ou aux paramètres de la trajectoire (k, générateur, initTemp, coolingRate,
+ * nb_changes, kempeRate, conflictSampling).
+ */
+AnnealingResult simulatedAnnealing(const Graph& graph, int k, double initTemp, double coolingRate, int nb_changes,
+                                   double kempeRate, const RunBudget& budget, unsigned seed, bool conflictSampling,
+                                   const std::string& engine, const GraphSource& source,
+                                   const AnnealingCheckpoint* resume, CheckpointWriter* checkpoints) {
+    //initialisation de la solution courante
+    Graph currentSol = graph.clone();
+    return annealingRun(currentSol, k, initTemp, coolingRate, nb_changes, kempeRate, budget, seed, nullptr,
+                        conflictSampling, engine, source, resume, checkpoints);
+}
+
+/**
+ * @brief Recuit simulé multi-départ : numThreads trajectoires indépendantes lancées en parallèle.
+ *
+ * Chaque trajectoire possède sa propre graine et sa propre coloration, la table d'adjacence du graphe est partagée
+ * en lecture seule. Toutes les trajectoires s'arrêtent dès que l'une d'elles atteint le coût cible du budget.
+ *
+ * @param graph Graphe à colorier, sa coloration sert de solution initiale à chaque trajectoire.
+ * @param k Le nombre de couleur utilisable.
+ * @param initTemp La température initiale.
+ * @param coolingRate Le coefficient de refroidissement.
+ * @param nb_changes Nombre de changement de couleur dans le voisinage.
+ * @param kempeRate La probabilité qu'un mouvement soit un échange de chaîne de Kempe.
+ * @param budget Le budget de chaque trajectoire (temps, itérations, coût cible, annulation).
+ * @param numThreads Le nombre de trajectoires (et de threads).
+ * @param baseSeed La graine dont sont dérivées les graines des trajectoires.
+ * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+ * @param engine Le générateur aléatoire : "xoshiro" (xoshiro256**) ou "mt19937".
+ * @return Le résultat de la meilleure trajectoire et les mesures fusionnées. Le graphe n'est pas modifié.
+ * @throw std::invalid_argument si numThreads < 1.
+ */
+MultiStartResult simulatedAnnealingMultiStart(const Graph& graph, int k, double initTemp, double coolingRate,
+                                              int nb_changes, double kempeRate, const RunBudget& budget,
+                                              int numThreads, unsigned baseSeed, bool conflictSampling,
+                                              const std::string& engine) {
+    if (numThreads < 1) {
+        throw std::invalid_argument("Le nombre de threads doit être au moins 1.");
+    }
+    // Annulé par la première trajectoire qui atteint le coût cible, ou avec le jeton du budget
+    CancellationToken solved(budget.getToken());
+    std::vector<Graph> replicas;
+    replicas.reserve(numThreads);
+    for (int t = 0; t < numThreads; t++) {
+        replicas.push_back(graph.clone());
+    }
+    std::vector<AnnealingResult> results(numThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            // Graine différente dans chaque thread
+            std::seed_seq seedSeq{baseSeed, static_cast<unsigned>(t)};
+            unsigned seed;
+            seedSeq.generate(&seed, &seed + 1);
+            results[t] = annealingRun(replicas[t], k, initTemp, coolingRate, nb_changes, kempeRate,
+                                      budget.child(-1, &solved), seed, &solved,
+                                      conflictSampling, engine);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    MultiStartResult multiStart;
+    std::vector<SearchStats> replicaStats;
+    for (int t = 0; t < numThreads; t++) {
+        multiStart.totalIterations += results[t].iterations;
+        if (results[t].bestCost < results[multiStart.bestReplica].bestCost) {
+            multiStart.bestReplica = t;
+        }
+        replicaStats.push_back(results[t].stats);
+    }
+    multiStart.stats = mergeParallelStats(replicaStats);
+    multiStart.best = std::move(results[multiStart.bestReplica]);
+    return multiStart;
+}
+
+/**
+ * @brief Algorithme de recherche local, choisi à chaque tour un noeud aléatoirement parmi les noeuds en conflit et
+ * lui donne la couleur qui minimise les conflits. La recherche s'arrête dès que la coloration est légale ou que le
+ * budget est épuisé.
+ *
+ * Avec kempe, lorsqu'aucune couleur ne diminue les conflits du noeud (plateau), la chaîne de Kempe du noeud vers
+ * l'une des couleurs de moindre conflit est évaluée et échangée si elle diminue le nombre de conflits.
+ *
+ * @param graph Graphe à colorier.
+ * @param k Le nombre de couleur utilisable.
+ * @param budget Le budget de la recherche (temps, itérations, coût cible, annulation).
+ * @param seed La graine du générateur aléatoire.
+ * @param stats Les mesures de la recherche, remplies si non nul.
+ * @param kempe true pour essayer les chaînes de Kempe sur les plateaux.
+ */
+void localResearch(Graph& graph, int k, RunBudget budget, unsigned seed, SearchStats* stats, bool kempe) {
+    std::mt19937 rng(seed);
+    KempeChain chain(kempe ? graph.getNumNodes() : 0);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    int bestCost = graph.countConflicts();
+    if (stats != nullptr) {
+        stats->recordBest(0, bestCost);
+    }
+
+    // Tampons réutilisés d'une itération à l'autre
+    std::vector<int> neighborColorCount(k);
+    std::vector<int> minColors;
+    minColors.reserve(k);
+
+    long long i = 0;
+    for (; !budget.shouldStop(i, graph.countConflicts()); i++) {
+        int valueRng = graph.randomConflictingNode(rng);
+        if (valueRng < 0) {
+            break; // Aucun noeud en conflit : la coloration est légale
+        }
+        std::fill(neighborColorCount.begin(), neighborColorCount.end(), 0);
+
+        // Compte les conflits du à chaque couleurs
+        if (graph.isDense()) {
+            for (int color = 0; color < k; color++) {
+                neighborColorCount[color] = graph.countNeighborsWithColor(valueRng, color);
+            }
+        } else {
+            for (int neighborID : graph.getNeighbors(valueRng)) {
+                int neighborColor = graph.getColor(neighborID);
+                if (neighborColor != -1) {
+                    neighborColorCount[neighborColor]++;
+                }
+            }
+        }
+
+        // Récupère le nombre minimum de conflits
+        int minValue = *std::min_element(neighborColorCount.begin(), neighborColorCount.end());
+
+        // Plateau : échange de la chaîne de Kempe vers l'une des couleurs minimales si elle diminue les conflits
+        int currentColor = graph.getColor(valueRng);
+        if (kempe && minValue >= neighborColorCount[currentColor]) {
+            int kempeColor = std::uniform_int_distribution<int>(0, k - 2)(rng);
+            kempeColor += kempeColor >= currentColor ? 1 : 0;
+            for (int color = 0; color < k; color++) {
+                int candidate = (kempeColor + color) % k;
+                if (candidate != currentColor && neighborColorCount[candidate] == minValue) {
+                    kempeColor = candidate;
+                    break;
+                }
+            }
+            if (chain.build(graph, valueRng, kempeColor) < 0) {
+                chain.apply(graph);
+                if (stats != nullptr) {
+                    stats->acceptedMoves++;
+                }
+                if (stats != nullptr && graph.countConflicts() < bestCost) {
+                    bestCost = graph.countConflicts();
+                    stats->recordBest(std::chrono::duration<double>(
+                            std::chrono::high_resolution_clock::now() - startTime).count(), bestCost);
+                }
+                continue;
+            }
+        }
+        minColors.clear();
+
+        // Crée la liste des couleurs possibles
+        for (int color = 0; color < k; color++) {
+            if (neighborColorCount[color] == minValue) {
+                minColors.push_back(color);
+            }
+        }
+
+        // Sélection aléatoire parmi les couleurs minimales
+        std::uniform_int_distribution<int> distributionMinColors(0, static_cast<int>(minColors.size()) - 1);
+        int idxMin = minColors[distributionMinColors(rng)];
+
+        // Mettez à jour conflictCount en conséquence
+        if (stats != nullptr && idxMin != graph.getColor(valueRng)) {
+            stats->acceptedMoves++;
+        }
+        graph.recolorNode(valueRng, idxMin);
+
+        if (stats != nullptr && i % SearchStats::SAMPLE_PERIOD == 0) {
+            stats->sample(std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - startTime).count(), 0, graph.countConflicts());
+        }
+        if (stats != nullptr && graph.countConflicts() < bestCost) {
+            bestCost = graph.countConflicts();
+            stats->recordBest(std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - startTime).count(), bestCost);
+        }
+    }
+    if (stats != nullptr) {
+        stats->iterations = i;
+        stats->elapsedSeconds = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+}
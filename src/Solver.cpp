@@ -0,0 +1,268 @@
+/**
+ * @file Solver.cpp
+ * @brief Implémente les algorithmes de k-coloration derrière l'interface Solver et leur fabrique.
+ */
+
+#include "../include/Solver.h"
+#include "../include/Coloring.h"
+#include "../include/SimulatedAnnealing.h"
+#include "../include/TabuCol.h"
+#include "../include/PartialCol.h"
+#include "../include/ParallelTempering.h"
+#include "../include/HybridEvolution.h"
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param start L'instant de départ.
+     * @return Le temps écoulé depuis start, en secondes.
+     */
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    /**
+     * @class PipelineSolver
+     * @brief Recuit simulé (une trajectoire ou plusieurs en parallèle) suivi de la recherche locale.
+     */
+    class PipelineSolver : public Solver {
+    public:
+        [[nodiscard]] std::string getName() const override {
+            return "pipeline";
+        }
+
+        SolveResult solve(const Graph& graph, int k, const SolverOptions& options,
+                          CancellationToken* token) const override {
+            SolveResult result;
+            auto start = Clock::now();
+            RunBudget annealingBudget(options.timeLimit, options.maxIter, options.targetConflicts, token);
+            AnnealingResult annealing;
+            SearchStats annealingStats;
+            if (options.numThreads > 1) {
+                MultiStartResult multiStart = simulatedAnnealingMultiStart(
+                        graph, k, options.initTemp, options.coolingRate, options.nbChanges, options.kempeRate,
+                        annealingBudget, options.numThreads, options.seed, options.conflictSampling, options.engine);
+                annealing = std::move(multiStart.best);
+                annealingStats = std::move(multiStart.stats);
+                result.details.emplace_back("Meilleure trajectoire", multiStart.bestReplica);
+                result.details.emplace_back("Nombre total d'iterations", multiStart.totalIterations);
+            } else {
+                std::unique_ptr<CheckpointWriter> checkpoints;
+                if (!options.checkpointFile.empty()) {
+                    AnnealingCheckpoint parameters;
+                    parameters.numEdges = graph.getNumEdges();
+                    parameters.source = options.graphSource;
+                    parameters.k = k;
+                    parameters.seed = options.seed;
+                    parameters.engine = options.engine;
+                    parameters.initTemp = options.initTemp;
+                    parameters.coolingRate = options.coolingRate;
+                    parameters.nbChanges = options.nbChanges;
+                    parameters.kempeRate = options.kempeRate;
+                    parameters.conflictSampling = options.conflictSampling;
+                    checkpoints = std::make_unique<CheckpointWriter>(options.checkpointFile, options.checkpointPeriod,
+                                                                     std::move(parameters));
+                }
+                annealing = simulatedAnnealing(graph, k, options.initTemp, options.coolingRate, options.nbChanges,
+                                               options.kempeRate, annealingBudget, options.seed,
+                                               options.conflictSampling, options.engine, options.graphSource,
+                                               options.resume, checkpoints.get());
+                annealingStats = annealing.stats;
+                if (checkpoints) {
+                    checkpoints->flush();
+                    result.details.emplace_back("Points de reprise ecrits", checkpoints->getWritten());
+                }
+            }
+            result.stats.append(annealingStats, 0, "annealing");
+            result.details.emplace_back("Nombre d'iterations pour meilleure solution", annealing.indexBestSol);
+            result.details.emplace_back("Temps pour meilleure solution", annealing.bestSolTime);
+            result.details.emplace_back("Nombre d'iterations au dernier changement de solution courante",
+                                        annealing.indexLastChange);
+            result.details.emplace_back("Temperature finale", annealing.finalTemperature);
+            result.details.emplace_back("Mouvements acceptes", annealingStats.acceptedMoves);
+            result.details.emplace_back("Taux d'acceptation", annealingStats.acceptanceRate());
+            result.details.emplace_back("Mouvements par seconde", annealingStats.movesPerSecond());
+            result.details.emplace_back("Temps d'execution du recuit simule (s)", annealingStats.elapsedSeconds);
+            result.details.emplace_back("Conflits apres recuit", annealing.bestCost);
+
+            // Recherche locale sur la meilleure coloration du recuit
+            Graph work = graph.clone();
+            work.setColoring(annealing.bestColoring);
+            SearchStats localStats;
+            double localStart = secondsSince(start);
+            localResearch(work, k, RunBudget(std::numeric_limits<double>::infinity(), 500000, options.targetConflicts,
+                                             token), options.seed + 1, &localStats, options.kempeRate > 0);
+            result.stats.append(localStats, localStart, "local");
+            result.details.emplace_back("Temps d'execution de la recherche local (s)", localStats.elapsedSeconds);
+            result.details.emplace_back("Mouvements appliques par la recherche local", localStats.acceptedMoves);
+
+            result.coloring = work.getColoring();
+            result.conflicts = work.countConflicts();
+            result.stats.elapsedSeconds = secondsSince(start);
+            return result;
+        }
+    };
+
+    /**
+     * @class TabuColSolver
+     * @brief Recherche tabou TabuCol.
+     */
+    class TabuColSolver : public Solver {
+    public:
+        [[nodiscard]] std::string getName() const override {
+            return "tabucol";
+        }
+
+        SolveResult solve(const Graph& graph, int k, const SolverOptions& options,
+                          CancellationToken* token) const override {
+            SolveResult result;
+            Graph work = graph.clone();
+            TabuCol tabuCol(work, k, options.seed);
+            result.conflicts = tabuCol.run(RunBudget(options.timeLimit, options.tabuIter, options.targetConflicts,
+                                                     token));
+            result.coloring = work.getColoring();
+            result.stats.append(tabuCol.getStats(), 0, getName());
+            result.stats.elapsedSeconds = tabuCol.getStats().elapsedSeconds;
+            result.details.emplace_back("Nombre d'iterations de la recherche tabou", tabuCol.getIterations());
+            result.details.emplace_back("Temps d'execution de la recherche tabou (s)", result.stats.elapsedSeconds);
+            return result;
+        }
+    };
+
+    /**
+     * @class PartialColSolver
+     * @brief Recherche tabou PartialCol sur les colorations partielles légales.
+     */
+    class PartialColSolver : public Solver {
+    public:
+        [[nodiscard]] std::string getName() const override {
+            return "partialcol";
+        }
+
+        SolveResult solve(const Graph& graph, int k, const SolverOptions& options,
+                          CancellationToken* token) const override {
+            SolveResult result;
+            Graph work = graph.clone();
+            PartialCol partialCol(work, k, options.seed);
+            result.conflicts = partialCol.run(RunBudget(options.timeLimit, options.tabuIter, options.targetConflicts,
+                                                        token));
+            result.coloring = work.getColoring();
+            result.stats.append(partialCol.getStats(), 0, getName());
+            result.stats.elapsedSeconds = partialCol.getStats().elapsedSeconds;
+            result.details.emplace_back("Nombre d'iterations de PartialCol", partialCol.getIterations());
+            result.details.emplace_back("Temps d'execution de PartialCol (s)", result.stats.elapsedSeconds);
+            result.details.emplace_back("Noeuds non colories de la meilleure coloration partielle",
+                                        partialCol.getBestUncolored());
+            return result;
+        }
+    };
+
+    /**
+     * @class TemperingSolver
+     * @brief Échange de répliques (parallel tempering).
+     */
+    class TemperingSolver : public Solver {
+    public:
+        [[nodiscard]] std::string getName() const override {
+            return "tempering";
+        }
+
+        SolveResult solve(const Graph& graph, int k, const SolverOptions& options,
+                          CancellationToken* token) const override {
+            SolveResult result;
+            ParallelTempering tempering(graph, k, options.numReplicas, options.minTemp, options.maxTemp,
+                                        options.seed);
+            result.conflicts = tempering.run(options.exchangeInterval, std::numeric_limits<long long>::max(),
+                                             RunBudget(options.timeLimit, std::numeric_limits<long long>::max(),
+                                                       options.targetConflicts, token));
+            result.coloring = tempering.getBestColoring();
+            result.stats.append(tempering.getStats(), 0, getName());
+            result.stats.elapsedSeconds = tempering.getStats().elapsedSeconds;
+            result.details.emplace_back("Nombre de mouvements de l'echange de repliques", tempering.getMoves());
+            result.details.emplace_back("Echanges tentes", tempering.getSwapAttempts());
+            result.details.emplace_back("Echanges acceptes", tempering.getSwapAccepted());
+            result.details.emplace_back("Temps pour meilleure solution (s)", tempering.getTimeToBest());
+            result.details.emplace_back("Temps d'execution de l'echange de repliques (s)",
+                                        result.stats.elapsedSeconds);
+            return result;
+        }
+    };
+
+    /**
+     * @class HybridSolver
+     * @brief Algorithme évolutionnaire hybride (croisement GPX et recherche tabou).
+     */
+    class HybridSolver : public Solver {
+    public:
+        [[nodiscard]] std::string getName() const override {
+            return "hybrid";
+        }
+
+        SolveResult solve(const Graph& graph, int k, const SolverOptions& options,
+                          CancellationToken* token) const override {
+            SolveResult result;
+            HybridEvolution hybrid(graph, k, options.populationSize, options.numThreads, options.seed);
+            result.conflicts = hybrid.run(options.childIter, std::numeric_limits<long long>::max(),
+                                          RunBudget(options.timeLimit, std::numeric_limits<long long>::max(),
+                                                    options.targetConflicts, token));
+            result.coloring = hybrid.getBestColoring();
+            result.stats.append(hybrid.getStats(), 0, getName());
+            result.stats.elapsedSeconds = hybrid.getStats().elapsedSeconds;
+            result.details.emplace_back("Nombre de generations de l'algorithme hybride", hybrid.getGenerations());
+            result.details.emplace_back("Nombre d'iterations de la recherche tabou", hybrid.getStats().iterations);
+            result.details.emplace_back("Temps pour meilleure solution (s)", hybrid.getTimeToBest());
+            result.details.emplace_back("Temps d'execution de l'algorithme hybride (s)", result.stats.elapsedSeconds);
+            return result;
+        }
+    };
+}
+
+/**
+ * @return Les noms des algorithmes disponibles.
+ */
+const std::vector<std::string>& solverNames() {
+    static const std::vector<std::string> names = {"pipeline", "tabucol", "partialcol", "tempering", "hybrid"};
+    return names;
+}
+
+/**
+ * @brief Crée l'algorithme de nom donné.
+ * @param name Le nom de l'algorithme (voir solverNames).
+ * @return L'algorithme.
+ * @throw std::invalid_argument si le nom est inconnu.
+ */
+std::unique_ptr<Solver> createSolver(const std::string& name) {
+    if (name == "pipeline") {
+        return std::make_unique<PipelineSolver>();
+    }
+    if (name == "tabucol") {
+        return std::make_unique<TabuColSolver>();
+    }
+    if (name == "partialcol") {
+        return std::make_unique<PartialColSolver>();
+    }
+    if (name == "tempering") {
+        return std::make_unique<TemperingSolver>();
+    }
+    if (name == "hybrid") {
+        return std::make_unique<HybridSolver>();
+    }
+    throw std::invalid_argument("Algorithme inconnu : " + name);
+}
+
+/**
+ * @brief Colorie le graphe avec l'heuristique constructive choisie.
+ * @param graph Le graphe à colorier.
+ * @param k Le nombre maximal de couleurs à utiliser.
+ * @param options Les paramètres des algorithmes (heuristique init).
+ */
+void initialColoring(Graph& graph, int k, const SolverOptions& options) {
+    if (options.init == "dsatur") {
+        dsaturColoring(graph, k);
+    } else {
+        greedyColoring(graph, k);
+    }
+}
@@ -0,0 +1,236 @@
+/**
+ * @file TabuCol.cpp
+ * @brief Implémente la recherche tabou TabuCol pour la k-coloration.
+ */
+
+#include "../include/TabuCol.h"
+#include <chrono>
+#include <algorithm>
+
+namespace {
+    // Partie aléatoire de la durée tabou : tirage uniforme dans [0, TENURE_RANDOM - 1].
+    constexpr int TENURE_RANDOM = 10;
+    // Coefficient appliqué au nombre de noeuds en conflit dans la durée tabou.
+    constexpr double TENURE_ALPHA = 0.6;
+    // Longueur (en itérations) de la fenêtre d'observation de la fluctuation du coût.
+    constexpr long long REACTIVE_PERIOD = 1000;
+    // Fluctuation (coût max - coût min sur la fenêtre) en dessous de laquelle la recherche est jugée bloquée.
+    constexpr int REACTIVE_THRESHOLD = 2;
+    // Allongement maximal de la durée tabou.
+    constexpr int REACTIVE_MAX_BONUS = 10;
+}
+
+/**
+ * @brief Constructeur de la classe TabuCol.
+ * @param graph Le graphe à colorier, sa coloration courante sert de solution initiale.
+ * @param k Le nombre de couleur utilisable.
+ * @param seed La graine du générateur aléatoire.
+ * @throw std::invalid_argument si k est inférieur à 1 ou si un noeud a une couleur hors de [0, k-1].
+ */
+TabuCol::TabuCol(Graph& graph, int k, unsigned seed)
+        : graph(graph), k(k), numNodes(graph.getNumNodes()), rng(seed), cost(0), iterations(0) {
+    if (k < 1) {
+        throw std::invalid_argument("Le nombre de couleurs doit être au moins 1.");
+    }
+    reset(graph.getColoring());
+}
+
+/**
+ * @brief Remplace la solution initiale sans réallouer les tables (utilisé pour enchaîner plusieurs recherches sur
+ * le même graphe).
+ * @param coloring La nouvelle solution initiale, une couleur par noeud.
+ * @throw std::invalid_argument si la taille ne correspond pas au graphe ou si une couleur est hors de [0, k-1].
+ */
+void TabuCol::reset(const std::vector<int>& coloring) {
+    if (static_cast<int>(coloring.size()) != numNodes) {
+        throw std::invalid_argument("La coloration initiale doit contenir une couleur par noeud.");
+    }
+    for (int color : coloring) {
+        if (color < 0 || color >= k) {
+            throw std::invalid_argument("La coloration initiale doit utiliser des couleurs dans [0, k-1].");
+        }
+    }
+    colors = coloring;
+
+    // Construction de la table des couleurs adjacentes
+    adjacentColors.assign(static_cast<size_t>(numNodes) * k, 0);
+    for (int v = 0; v < numNodes; v++) {
+        for (int u : graph.getNeighbors(v)) {
+            adjacentColors[static_cast<size_t>(v) * k + colors[u]]++;
+        }
+    }
+    tabuUntil.assign(static_cast<size_t>(numNodes) * k, 0);
+
+    // Ensemble des noeuds en conflit et nombre de conflits
+    conflicting.clear();
+    conflictingPos.assign(numNodes, -1);
+    cost = 0;
+    for (int v = 0; v < numNodes; v++) {
+        cost += adjacentColors[static_cast<size_t>(v) * k + colors[v]];
+        updateConflicting(v);
+    }
+    cost /= 2;
+}
+
+/**
+ * @brief Met à jour l'appartenance d'un noeud à l'ensemble des noeuds en conflit.
+ * @param v L'ID du noeud.
+ */
+void TabuCol::updateConflicting(int v) {
+    bool inConflict = adjacentColors[static_cast<size_t>(v) * k + colors[v]] > 0;
+    if (inConflict && conflictingPos[v] < 0) {
+        conflictingPos[v] = static_cast<int>(conflicting.size());
+        conflicting.push_back(v);
+    } else if (!inConflict && conflictingPos[v] >= 0) {
+        // Retrait en O(1) : le dernier élément prend la place du noeud retiré
+        int last = conflicting.back();
+        conflicting[conflictingPos[v]] = last;
+        conflictingPos[last] = conflictingPos[v];
+        conflicting.pop_back();
+        conflictingPos[v] = -1;
+    }
+}
+
+/**
+ * @brief Change la couleur d'un noeud et met à jour la table des couleurs adjacentes, le nombre de conflits
+ * et l'ensemble des noeuds en conflit.
+ * @param v L'ID du noeud.
+ * @param newColor La nouvelle couleur.
+ */
+void TabuCol::applyMove(int v, int newColor) {
+    int oldColor = colors[v];
+    const int* row = &adjacentColors[static_cast<size_t>(v) * k];
+    cost += row[newColor] - row[oldColor];
+    colors[v] = newColor;
+    for (int u : graph.getNeighbors(v)) {
+        int* neighborRow = &adjacentColors[static_cast<size_t>(u) * k];
+        neighborRow[oldColor]--;
+        neighborRow[newColor]++;
+        if (colors[u] == oldColor || colors[u] == newColor) {
+            updateConflicting(u);
+        }
+    }
+    updateConflicting(v);
+}
+
+/**
+ * @brief Lance la recherche tabou puis applique la meilleure coloration rencontrée au graphe, y compris si la
+ * recherche est interrompue.
+ * @param budget Le budget de la recherche (temps, itérations, coût cible, annulation).
+ * @return Le nombre de conflits de la meilleure coloration rencontrée.
+ */
+int TabuCol::run(RunBudget budget) {
+    std::vector<int> bestColors = colors;
+    int bestCost = cost;
+    int reactiveBonus = 0;
+    int windowMin = cost;
+    int windowMax = cost;
+    std::uniform_int_distribution<int> tenureDistribution(0, TENURE_RANDOM - 1);
+    auto startTime = std::chrono::steady_clock::now();
+    stats = SearchStats();
+    stats.recordBest(0, bestCost);
+
+    iterations = 0;
+    while (k > 1 && !budget.shouldStop(iterations, bestCost)) {
+        iterations++;
+
+        // Recherche du meilleur mouvement autorisé parmi les noeuds en conflit
+        int bestDelta = 0;
+        int bestNode = -1;
+        int bestColor = -1;
+        int ties = 0;
+        for (int v : conflicting) {
+            const int* row = &adjacentColors[static_cast<size_t>(v) * k];
+            const long long* tabuRow = &tabuUntil[static_cast<size_t>(v) * k];
+            int currentColor = colors[v];
+            int currentCount = row[currentColor];
+            for (int c = 0; c < k; c++) {
+                if (c == currentColor) {
+                    continue;
+                }
+                int delta = row[c] - currentCount;
+                // Un mouvement tabou n'est autorisé que s'il améliore la meilleure solution (aspiration)
+                if (tabuRow[c] >= iterations && cost + delta >= bestCost) {
+                    continue;
+                }
+                if (bestNode < 0 || delta < bestDelta) {
+                    bestDelta = delta;
+                    bestNode = v;
+                    bestColor = c;
+                    ties = 1;
+                } else if (delta == bestDelta) {
+                    // Choix uniforme parmi les meilleurs mouvements
+                    ties++;
+                    if (std::uniform_int_distribution<int>(0, ties - 1)(rng) == 0) {
+                        bestNode = v;
+                        bestColor = c;
+                    }
+                }
+            }
+        }
+
+        if (bestNode < 0) {
+            // Tous les mouvements sont tabous : mouvement aléatoire sur un noeud en conflit
+            bestNode = conflicting[std::uniform_int_distribution<int>(0, static_cast<int>(conflicting.size()) - 1)(rng)];
+            bestColor = std::uniform_int_distribution<int>(0, k - 2)(rng);
+            if (bestColor >= colors[bestNode]) {
+                bestColor++;
+            }
+        }
+
+        int oldColor = colors[bestNode];
+        int previousCost = cost;
+        applyMove(bestNode, bestColor);
+        if (cost > previousCost) {
+            stats.uphillMoves++;
+        }
+
+        // Durée tabou dynamique et réactive : allongée si le coût stagne sur la fenêtre, raccourcie sinon
+        windowMin = std::min(windowMin, cost);
+        windowMax = std::max(windowMax, cost);
+        if (iterations % REACTIVE_PERIOD == 0) {
+            if (windowMax - windowMin < REACTIVE_THRESHOLD) {
+                reactiveBonus = std::min(reactiveBonus + 1, REACTIVE_MAX_BONUS);
+            } else if (reactiveBonus > 0) {
+                reactiveBonus--;
+            }
+            windowMin = cost;
+            windowMax = cost;
+        }
+        long long tenure = tenureDistribution(rng)
+                           + static_cast<long long>(TENURE_ALPHA * static_cast<double>(conflicting.size()))
+                           + reactiveBonus;
+        tabuUntil[static_cast<size_t>(bestNode) * k + oldColor] = iterations + tenure;
+
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestColors = colors;
+            stats.recordBest(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count(),
+                             bestCost);
+        }
+
+        if (iterations % SearchStats::SAMPLE_PERIOD == 0) {
+            stats.sample(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count(), 0, cost);
+        }
+    }
+
+    stats.iterations = iterations;
+    stats.acceptedMoves = iterations; // Chaque itération applique un mouvement
+    stats.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    graph.setColoring(bestColors);
+    return bestCost;
+}
+
+/**
+ * @return Le nombre d'itérations effectuées lors du dernier appel à run.
+ */
+long long TabuCol::getIterations() const {
+    return iterations;
+}
+
+/**
+ * @return Les mesures du dernier appel à run.
+ */
+const SearchStats& TabuCol::getStats() const {
+    return stats;
+}
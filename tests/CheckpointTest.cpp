@@ -0,0 +1,152 @@
+/**
+ * @file CheckpointTest.cpp
+ * @brief Vérifie qu'un point de reprise écrit, relu puis repris reproduit exactement la trajectoire du recuit simulé
+ * menée sans interruption.
+ */
+
+#include "../include/Checkpoint.h"
+#include "../include/Graph.h"
+#include "../include/GraphGenerator.h"
+#include "../include/SimulatedAnnealing.h"
+#include "TestUtils.h"
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int K = 10;
+    constexpr double INIT_TEMP = 2.0;
+    constexpr double COOLING_RATE = 0.999;
+    constexpr int NB_CHANGES = 1;
+    constexpr unsigned SEED = 42;
+    constexpr long long SPLIT = 15000; // L'itération du point de reprise.
+    constexpr long long TOTAL = 40000; // Le nombre d'itérations de la trajectoire complète.
+
+    /**
+     * @brief Le fichier source fictif et la renumérotation de la trajectoire.
+     * @return L'identité du graphe enregistrée dans le point de reprise.
+     */
+    GraphSource testSource() {
+        GraphSource source;
+        source.size = 123456;
+        source.time = 789;
+        source.ordering = "rcm";
+        return source;
+    }
+
+    /**
+     * @brief Vérifie qu'une reprise est refusée.
+     * @param graph Le graphe colorié (coloration initiale).
+     * @param kempeRate La probabilité d'un échange de chaîne de Kempe.
+     * @param conflictSampling true pour ne tirer que des noeuds en conflit.
+     * @param engine Le générateur aléatoire.
+     * @param source Le fichier source et la renumérotation du graphe.
+     * @param coolingRate Le coefficient de refroidissement.
+     * @param checkpoint Le point de reprise.
+     */
+    void checkRejected(const Graph& graph, double kempeRate, bool conflictSampling, const std::string& engine,
+                       const GraphSource& source, double coolingRate, const AnnealingCheckpoint& checkpoint) {
+        bool thrown = false;
+        try {
+            simulatedAnnealing(graph, K, INIT_TEMP, coolingRate, NB_CHANGES, kempeRate,
+                               RunBudget(std::numeric_limits<double>::infinity(), TOTAL), SEED, conflictSampling,
+                               engine, source, &checkpoint);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    /**
+     * @brief Compare une trajectoire complète à la même trajectoire arrêtée à SPLIT itérations, écrite dans un point
+     * de reprise, relue puis reprise jusqu'à TOTAL itérations.
+     * @param graph Le graphe colorié (coloration initiale).
+     * @param kempeRate La probabilité d'un échange de chaîne de Kempe.
+     * @param engine Le générateur aléatoire.
+     */
+    void checkResume(const Graph& graph, double kempeRate, const std::string& engine) {
+        std::string filename = (std::filesystem::temp_directory_path() / "mh_checkpoint_test.ckpt").string();
+        AnnealingResult straight = simulatedAnnealing(graph, K, INIT_TEMP, COOLING_RATE, NB_CHANGES, kempeRate,
+                                                      RunBudget(std::numeric_limits<double>::infinity(), TOTAL),
+                                                      SEED, false, engine, testSource());
+        {
+            // Une période d'une heure : seul le point de reprise de l'arrêt est écrit
+            AnnealingCheckpoint parameters;
+            parameters.numEdges = graph.getNumEdges();
+            parameters.source = testSource();
+            parameters.k = K;
+            parameters.seed = SEED;
+            parameters.engine = engine;
+            parameters.initTemp = INIT_TEMP;
+            parameters.coolingRate = COOLING_RATE;
+            parameters.nbChanges = NB_CHANGES;
+            parameters.kempeRate = kempeRate;
+            CheckpointWriter writer(filename, 3600, parameters);
+            AnnealingResult first = simulatedAnnealing(graph, K, INIT_TEMP, COOLING_RATE, NB_CHANGES, kempeRate,
+                                                       RunBudget(std::numeric_limits<double>::infinity(), SPLIT),
+                                                       SEED, false, engine, testSource(), nullptr, &writer);
+            CHECK(first.iterations == SPLIT);
+        }
+        AnnealingCheckpoint checkpoint = readCheckpoint(filename);
+        std::filesystem::remove(filename);
+        CHECK(checkpoint.iteration == SPLIT);
+        CHECK(checkpoint.k == K);
+        CHECK(checkpoint.engine == engine);
+        CHECK(checkpoint.initTemp == INIT_TEMP);
+        CHECK(checkpoint.coolingRate == COOLING_RATE);
+        CHECK(checkpoint.nbChanges == NB_CHANGES);
+        CHECK(checkpoint.kempeRate == kempeRate);
+        CHECK(!checkpoint.conflictSampling);
+        CHECK(checkpoint.numEdges == graph.getNumEdges());
+        CHECK(checkpoint.source.size == testSource().size);
+        CHECK(checkpoint.source.time == testSource().time);
+        CHECK(checkpoint.source.ordering == testSource().ordering);
+
+        // Une reprise avec d'autres paramètres ou sur un autre graphe que ceux du point de reprise est refusée
+        checkRejected(graph, kempeRate, false, engine, testSource(), COOLING_RATE * 0.99, checkpoint);
+        checkRejected(graph, kempeRate, true, engine, testSource(), COOLING_RATE, checkpoint);
+        GraphSource otherOrdering = testSource();
+        otherOrdering.ordering = "degree";
+        checkRejected(graph, kempeRate, false, engine, otherOrdering, COOLING_RATE, checkpoint);
+        GraphSource otherFile = testSource();
+        otherFile.time++;
+        checkRejected(graph, kempeRate, false, engine, otherFile, COOLING_RATE, checkpoint);
+        // Même nombre de noeuds, mais un autre graphe
+        GeneratedGraph generated = generateRandomGraph(graph.getNumNodes(), 0.4, 9);
+        Graph otherGraph(generated.numNodes, generated.edges);
+        checkRejected(otherGraph, kempeRate, false, engine, testSource(), COOLING_RATE, checkpoint);
+
+        AnnealingResult resumed = simulatedAnnealing(graph, K, INIT_TEMP, COOLING_RATE, NB_CHANGES, kempeRate,
+                                                     RunBudget(std::numeric_limits<double>::infinity(), TOTAL),
+                                                     SEED, false, engine, testSource(), &checkpoint);
+        CHECK(straight.bestCost > 0);
+        CHECK(resumed.iterations == straight.iterations);
+        CHECK(resumed.bestCost == straight.bestCost);
+        CHECK(resumed.bestColoring == straight.bestColoring);
+        CHECK(resumed.indexBestSol == straight.indexBestSol);
+        CHECK(resumed.indexLastChange == straight.indexLastChange);
+        CHECK(resumed.stats.acceptedMoves == straight.stats.acceptedMoves);
+        CHECK(resumed.stats.uphillMoves == straight.stats.uphillMoves);
+        CHECK(resumed.finalTemperature == straight.finalTemperature);
+    }
+}
+
+int main() {
+    GeneratedGraph generated = generateRandomGraph(300, 0.5, 8);
+    Graph graph(generated.numNodes, generated.edges);
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> colorDistribution(0, K - 1);
+    std::vector<int> coloring(generated.numNodes);
+    for (int& color : coloring) {
+        color = colorDistribution(rng);
+    }
+    graph.setColoring(coloring);
+
+    checkResume(graph, 0, "xoshiro");
+    checkResume(graph, 0, "mt19937");
+    checkResume(graph, 0.2, "xoshiro");
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file CliqueBoundTest.cpp
+ * @brief Vérifie la borne inférieure par clique : la clique rendue est une clique du graphe, la recherche exacte
+ * retrouve une clique cachée de taille connue et l'heuristique seule est rendue lorsque la recherche exacte est
+ * désactivée.
+ */
+
+#include "../include/CliqueBound.h"
+#include "../include/Graph.h"
+#include "../include/GraphGenerator.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr long long GENEROUS_NODES = 10000000; // Un arbre de recherche assez grand pour terminer.
+
+    /**
+     * @brief Vérifie que les noeuds forment une clique du graphe, à partir de la liste d'arêtes.
+     * @param generated Le graphe.
+     * @param clique Les noeuds de la clique.
+     */
+    void checkClique(const GeneratedGraph& generated, const std::vector<int>& clique) {
+        std::set<std::pair<int, int>> edges;
+        for (const auto& [u, v] : generated.edges) {
+            edges.emplace(std::min(u, v), std::max(u, v));
+        }
+        for (size_t i = 0; i < clique.size(); i++) {
+            CHECK(clique[i] >= 0 && clique[i] < generated.numNodes);
+            for (size_t j = i + 1; j < clique.size(); j++) {
+                CHECK(edges.count({std::min(clique[i], clique[j]), std::max(clique[i], clique[j])}) == 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Calcule la borne avec et sans recherche exacte et vérifie les deux résultats.
+     * @param generated Le graphe.
+     * @param expected La taille de la clique maximum du graphe.
+     */
+    void checkBound(const GeneratedGraph& generated, int expected) {
+        Graph graph(generated.numNodes, generated.edges);
+
+        CliqueBound bound = cliqueLowerBound(graph, GENEROUS_NODES);
+        checkClique(generated, bound.clique);
+        CHECK(bound.exact);
+        CHECK(bound.lowerBound() == expected);
+        CHECK(bound.nodes > 0);
+
+        // Sans recherche exacte, seule la clique de l'heuristique est rendue
+        CliqueBound heuristic = cliqueLowerBound(graph, 0);
+        checkClique(generated, heuristic.clique);
+        CHECK(heuristic.clique == greedyClique(graph));
+        CHECK(!heuristic.exact);
+        CHECK(heuristic.nodes == 0);
+        CHECK(heuristic.lowerBound() <= bound.lowerBound());
+    }
+
+    /**
+     * @brief Graphe aléatoire G(n, p) dans lequel une clique de taille m est cachée sur des noeuds tirés au hasard.
+     * @param numNodes Le nombre de noeuds.
+     * @param p La densité du graphe aléatoire.
+     * @param m La taille de la clique cachée.
+     * @param seed La graine.
+     * @return Le graphe.
+     */
+    GeneratedGraph plantedClique(int numNodes, double p, int m, unsigned seed) {
+        GeneratedGraph generated = generateRandomGraph(numNodes, p, seed);
+        std::vector<int> nodes(numNodes);
+        for (int v = 0; v < numNodes; v++) {
+            nodes[v] = v;
+        }
+        std::mt19937 rng(seed);
+        std::shuffle(nodes.begin(), nodes.end(), rng);
+        std::set<std::pair<int, int>> edges;
+        for (const auto& [u, v] : generated.edges) {
+            edges.emplace(std::min(u, v), std::max(u, v));
+        }
+        for (int i = 0; i < m; i++) {
+            for (int j = i + 1; j < m; j++) {
+                std::pair<int, int> edge(std::min(nodes[i], nodes[j]), std::max(nodes[i], nodes[j]));
+                if (edges.insert(edge).second) {
+                    generated.edges.push_back(edge);
+                }
+            }
+        }
+        return generated;
+    }
+}
+
+int main() {
+    // Une clique de 12 noeuds dans un graphe où les cliques aléatoires ont au plus 4 ou 5 noeuds
+    checkBound(plantedClique(300, 0.1, 12, 5), 12);
+    // Plus dense : la clique cachée se distingue moins par le degré de ses noeuds
+    checkBound(plantedClique(150, 0.5, 16, 6), 16);
+    // Graphes de Leighton : une clique de taille k et une k-coloration légale, la clique maximum a donc k noeuds
+    checkBound(generateLeightonGraph(200, 10, 0.2, 7), 10);
+    checkBound(generateLeightonGraph(300, 15, 0.3, 8), 15);
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file GraphOrderingTest.cpp
+ * @brief Vérifie que reorderGraph produit un graphe isomorphe et que restoreOriginalColoring inverse la renumérotation.
+ */
+
+#include "../include/Graph.h"
+#include "../include/GraphGenerator.h"
+#include "../include/GraphOrdering.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Renumérote le graphe, puis vérifie la permutation, les arêtes et le retour d'une coloration aléatoire vers
+     * la numérotation d'origine.
+     * @param generated Le graphe à tester.
+     * @param method Le nom de la renumérotation.
+     */
+    void checkReordering(const GeneratedGraph& generated, const std::string& method) {
+        Graph graph(generated.numNodes, generated.edges);
+        Reordering reordering = reorderGraph(graph, method);
+        int numNodes = graph.getNumNodes();
+        CHECK(reordering.graph.getNumNodes() == numNodes);
+        CHECK(reordering.graph.getNumEdges() == graph.getNumEdges());
+
+        // newToOriginal est une permutation
+        std::vector<int> sorted = reordering.newToOriginal;
+        std::sort(sorted.begin(), sorted.end());
+        bool permutation = static_cast<int>(sorted.size()) == numNodes;
+        for (int i = 0; permutation && i < numNodes; i++) {
+            permutation = sorted[i] == i;
+        }
+        CHECK(permutation);
+        if (!permutation) {
+            return;
+        }
+
+        // Chaque arête du graphe renuméroté est une arête du graphe d'origine
+        for (int i = 0; i < numNodes; i++) {
+            NeighborRange original = graph.getNeighbors(reordering.newToOriginal[i]);
+            for (int j : reordering.graph.getNeighbors(i)) {
+                CHECK(std::find(original.begin(), original.end(), reordering.newToOriginal[j]) != original.end());
+            }
+        }
+
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> colorDistribution(0, 5);
+        std::vector<int> coloring(numNodes);
+        for (int& color : coloring) {
+            color = colorDistribution(rng);
+        }
+        reordering.graph.setColoring(coloring);
+        std::vector<int> restored = restoreOriginalColoring(reordering, reordering.graph.getColoring());
+        for (int i = 0; i < numNodes; i++) {
+            CHECK(restored[reordering.newToOriginal[i]] == coloring[i]);
+        }
+        graph.setColoring(restored);
+        CHECK(graph.countConflicts() == reordering.graph.countConflicts());
+    }
+}
+
+int main() {
+    GeneratedGraph sparse = generateRandomGraph(1500, 4.0 / 1499, 5);
+    GeneratedGraph dense = generateRandomGraph(150, 0.4, 6);
+    for (const std::string& method : orderingNames()) {
+        checkReordering(sparse, method);
+        checkReordering(dense, method);
+    }
+
+    bool thrown = false;
+    try {
+        vertexOrdering(Graph(sparse.numNodes, sparse.edges), "inconnue");
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file GraphReductionTest.cpp
+ * @brief Vérifie que la réinsertion des noeuds retirés par peelLowDegree n'ajoute aucun conflit à la coloration du
+ * noyau.
+ */
+
+#include "../include/Graph.h"
+#include "../include/GraphGenerator.h"
+#include "../include/GraphReduction.h"
+#include "TestUtils.h"
+#include <random>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Réduit le graphe, colorie le noyau aléatoirement (avec des conflits) puis réinsère les noeuds retirés.
+     * @param generated Le graphe à tester.
+     * @param k Le nombre de couleur utilisable.
+     * @param seed La graine de la coloration du noyau.
+     */
+    void checkReinsertion(const GeneratedGraph& generated, int k, unsigned seed) {
+        Graph graph(generated.numNodes, generated.edges);
+        Reduction reduction = peelLowDegree(graph, k);
+        CHECK(!reduction.removed.empty());
+        CHECK(reduction.core.getNumNodes() + static_cast<int>(reduction.removed.size()) == graph.getNumNodes());
+        for (int v = 0; v < reduction.core.getNumNodes(); v++) {
+            CHECK(reduction.core.getDegree(v) >= k);
+        }
+
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> colorDistribution(0, k - 1);
+        std::vector<int> coreColoring(reduction.core.getNumNodes());
+        for (int& color : coreColoring) {
+            color = colorDistribution(rng);
+        }
+        reduction.core.setColoring(coreColoring);
+
+        reinsertPeeled(graph, reduction, coreColoring, k);
+        CHECK(graph.countConflicts() == reduction.core.countConflicts());
+        for (int v = 0; v < graph.getNumNodes(); v++) {
+            CHECK(graph.getColor(v) >= 0 && graph.getColor(v) < k);
+        }
+        for (int v : reduction.removed) {
+            CHECK(graph.getConflictCount()[v] == 0);
+        }
+    }
+}
+
+int main() {
+    // Degré moyen 6 : un noyau dense entouré de nombreux noeuds de faible degré
+    checkReinsertion(generateRandomGraph(2000, 6.0 / 1999, 3), 4, 1);
+    checkReinsertion(generateRandomGraph(2000, 6.0 / 1999, 4), 5, 2);
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file GraphTest.cpp
+ * @brief Vérifie que les conflits maintenus de manière incrémentale par Graph sont égaux à un recomptage complet, en
+ * représentation creuse (table d'adjacence) et dense (matrice de bits), y compris après des échanges de chaînes de
+ * Kempe.
+ */
+
+#include "../include/Graph.h"
+#include "../include/GraphGenerator.h"
+#include "../include/KempeChain.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Recompte les conflits à partir de la liste d'arêtes et de la coloration, sans utiliser l'état du graphe.
+     * @param graph Le graphe colorié.
+     * @param edges Les arêtes du graphe.
+     * @param perNode Le nombre de voisins de même couleur de chaque noeud, rempli par la fonction.
+     * @return Le nombre d'arêtes en conflit.
+     */
+    int recountConflicts(const Graph& graph, const std::vector<std::pair<int, int>>& edges, std::vector<int>& perNode) {
+        perNode.assign(graph.getNumNodes(), 0);
+        int conflicts = 0;
+        for (const auto& [u, v] : edges) {
+            if (graph.getColor(u) >= 0 && graph.getColor(u) == graph.getColor(v)) {
+                conflicts++;
+                perNode[u]++;
+                perNode[v]++;
+            }
+        }
+        return conflicts;
+    }
+
+    /**
+     * @brief Applique une suite de recolorations aléatoires et compare après chacune l'état incrémental du graphe
+     * (nombre de conflits, conflits par noeud, noeuds en conflit, variation annoncée par recolorDelta) au recomptage.
+     * @param generated Le graphe à tester.
+     * @param k Le nombre de couleur utilisé.
+     * @param dense La représentation attendue.
+     */
+    void checkIncrementalConflicts(const GeneratedGraph& generated, int k, bool dense) {
+        Graph graph(generated.numNodes, generated.edges);
+        CHECK(graph.isDense() == dense);
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> nodeDistribution(0, generated.numNodes - 1);
+        std::uniform_int_distribution<int> colorDistribution(0, k - 1);
+
+        // Coloration partielle : les noeuds non coloriés ne sont jamais en conflit
+        std::vector<int> coloring(generated.numNodes);
+        for (int& color : coloring) {
+            color = colorDistribution(rng) - 1;
+        }
+        graph.setColoring(coloring);
+        std::vector<int> perNode;
+        CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+
+        for (int move = 0; move < 2000; move++) {
+            int id = nodeDistribution(rng);
+            int color = colorDistribution(rng);
+            int before = graph.countConflicts();
+            int delta = graph.recolorDelta(id, color);
+            graph.recolorNode(id, color);
+            CHECK(graph.countConflicts() == before + delta);
+            if (move % 100 == 0) {
+                CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+                CHECK(graph.getConflictCount() == perNode);
+                int conflicting = 0;
+                for (int count : perNode) {
+                    conflicting += count > 0;
+                }
+                CHECK(static_cast<int>(graph.getConflictingNodes().size()) == conflicting);
+            }
+        }
+        CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+        CHECK(graph.getConflictCount() == perNode);
+    }
+
+    /**
+     * @brief Applique une suite d'échanges de chaînes de Kempe sur une coloration aléatoire et compare la variation
+     * annoncée par build au nombre de conflits du graphe, puis l'état du graphe au recomptage. Une seconde chaîne, dont
+     * le compteur de génération déborde après quelques parcours, doit donner les mêmes chaînes.
+     * @param generated Le graphe à tester.
+     * @param k Le nombre de couleur utilisé.
+     * @param dense La représentation attendue.
+     */
+    void checkKempeChains(const GeneratedGraph& generated, int k, bool dense) {
+        Graph graph(generated.numNodes, generated.edges);
+        CHECK(graph.isDense() == dense);
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> nodeDistribution(0, generated.numNodes - 1);
+        std::uniform_int_distribution<int> colorDistribution(0, k - 1);
+        std::vector<int> coloring(generated.numNodes);
+        for (int& color : coloring) {
+            color = colorDistribution(rng);
+        }
+        graph.setColoring(coloring);
+
+        KempeChain chain(generated.numNodes);
+        KempeChain wrapping(generated.numNodes, UINT32_MAX - 3);
+        std::vector<int> perNode;
+        for (int move = 0; move < 1000; move++) {
+            int v = nodeDistribution(rng);
+            int otherColor = colorDistribution(rng);
+            if (otherColor == graph.getColor(v)) {
+                continue;
+            }
+            int before = graph.countConflicts();
+            int delta = chain.build(graph, v, otherColor);
+            // L'échange ne crée aucun conflit : les voisins de la couleur opposée sont dans la chaîne
+            CHECK(delta <= 0);
+            if (move < 20) {
+                CHECK(wrapping.build(graph, v, otherColor) == delta);
+                std::vector<int> expected = chain.getNodes();
+                std::vector<int> nodes = wrapping.getNodes();
+                std::sort(expected.begin(), expected.end());
+                std::sort(nodes.begin(), nodes.end());
+                CHECK(nodes == expected);
+            }
+            chain.apply(graph);
+            CHECK(graph.countConflicts() == before + delta);
+            if (move % 100 == 0) {
+                CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+                CHECK(graph.getConflictCount() == perNode);
+            }
+        }
+        CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+        CHECK(graph.getConflictCount() == perNode);
+    }
+
+    /**
+     * @brief Graphe dense dont la liste d'arêtes contient des doublons ("e 1 2" et "e 2 1") et des boucles : les
+     * conflits sont comptés une seule fois par arête, quelle que soit la représentation utilisée.
+     */
+    void checkDuplicateEdges() {
+        GeneratedGraph generated = generateRandomGraph(100, 0.3, 9);
+        std::vector<std::pair<int, int>> withDuplicates = generated.edges;
+        for (size_t e = 0; e < generated.edges.size(); e += 3) {
+            withDuplicates.emplace_back(generated.edges[e].second, generated.edges[e].first);
+        }
+        for (int v = 0; v < generated.numNodes; v += 7) {
+            withDuplicates.emplace_back(v, v);
+        }
+        Graph graph(generated.numNodes, withDuplicates);
+        CHECK(graph.isDense());
+        CHECK(graph.getNumEdges() == static_cast<int>(generated.edges.size()));
+
+        std::mt19937 rng(13);
+        std::uniform_int_distribution<int> nodeDistribution(0, generated.numNodes - 1);
+        std::uniform_int_distribution<int> colorDistribution(0, 3);
+        std::vector<int> perNode;
+        for (int move = 0; move < 1000; move++) {
+            graph.recolorNode(nodeDistribution(rng), colorDistribution(rng));
+        }
+        CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+        CHECK(graph.getConflictCount() == perNode);
+        // Le recomptage complet du graphe donne le même état que les mises à jour incrémentales
+        graph.setConflictCount();
+        CHECK(graph.countConflicts() == recountConflicts(graph, generated.edges, perNode));
+        CHECK(graph.getConflictCount() == perNode);
+    }
+}
+
+int main() {
+    // Densité 0.02 : table d'adjacence seule
+    checkIncrementalConflicts(generateRandomGraph(400, 0.02, 1), 5, false);
+    // Densité 0.5 : matrice de bits (popcount et parcours des bits)
+    checkIncrementalConflicts(generateRandomGraph(200, 0.5, 2), 8, true);
+    checkKempeChains(generateRandomGraph(400, 0.02, 3), 4, false);
+    checkKempeChains(generateRandomGraph(200, 0.5, 4), 20, true);
+    checkDuplicateEdges();
+    return testFailures() == 0 ? 0 : 1;
+}
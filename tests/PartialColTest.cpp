@@ -0,0 +1,90 @@
+/**
+ * @file PartialColTest.cpp
+ * @brief Vérifie PartialCol par recomptage : la meilleure coloration partielle est légale et compte exactement
+ * getBestUncolored() noeuds non coloriés, et le nombre de conflits rendu par run est celui du graphe complété.
+ */
+
+#include "../include/Graph.h"
+#include "../include/GraphGenerator.h"
+#include "../include/PartialCol.h"
+#include "TestUtils.h"
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Recompte les conflits d'une coloration à partir de la liste d'arêtes, les noeuds non coloriés n'étant
+     * jamais en conflit.
+     * @param edges Les arêtes du graphe.
+     * @param coloring La coloration, PartialCol::UNCOLORED pour un noeud non colorié.
+     * @return Le nombre d'arêtes en conflit.
+     */
+    int recountConflicts(const std::vector<std::pair<int, int>>& edges, const std::vector<int>& coloring) {
+        int conflicts = 0;
+        for (const auto& [u, v] : edges) {
+            conflicts += coloring[u] != PartialCol::UNCOLORED && coloring[u] == coloring[v];
+        }
+        return conflicts;
+    }
+
+    /**
+     * @brief Lance plusieurs recherches PartialCol depuis des colorations aléatoires et compare après chacune le
+     * résultat au recomptage.
+     * @param generated Le graphe à tester.
+     * @param k Le nombre de couleur utilisable, inférieur au nombre chromatique pour que des noeuds restent non
+     * coloriés.
+     * @param iterations Le nombre d'itérations de chaque recherche.
+     */
+    void checkPartialCol(const GeneratedGraph& generated, int k, long long iterations) {
+        Graph graph(generated.numNodes, generated.edges);
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<int> colorDistribution(0, k - 1);
+        std::vector<int> coloring(generated.numNodes);
+        for (int& color : coloring) {
+            color = colorDistribution(rng);
+        }
+        graph.setColoring(coloring);
+        PartialCol search(graph, k, 17);
+
+        for (int restart = 0; restart < 3; restart++) {
+            if (restart > 0) {
+                for (int& color : coloring) {
+                    color = colorDistribution(rng);
+                }
+                search.reset(coloring);
+            }
+            int conflicts = search.run(RunBudget(std::numeric_limits<double>::infinity(), iterations));
+            CHECK(search.getIterations() == iterations);
+
+            // La meilleure coloration partielle est légale et compte getBestUncolored() noeuds non coloriés
+            const std::vector<int>& best = search.getBestPartialColoring();
+            CHECK(static_cast<int>(best.size()) == generated.numNodes);
+            int uncolored = 0;
+            for (int color : best) {
+                uncolored += color == PartialCol::UNCOLORED;
+                CHECK(color == PartialCol::UNCOLORED || (color >= 0 && color < k));
+            }
+            CHECK(search.getBestUncolored() > 0);
+            CHECK(uncolored == search.getBestUncolored());
+            CHECK(recountConflicts(generated.edges, best) == 0);
+
+            // Le graphe reçoit la coloration partielle complétée, dont run rend le nombre de conflits
+            std::vector<int> completed = graph.getColoring();
+            for (int v = 0; v < generated.numNodes; v++) {
+                CHECK(completed[v] >= 0 && completed[v] < k);
+                CHECK(best[v] == PartialCol::UNCOLORED || completed[v] == best[v]);
+            }
+            CHECK(conflicts == recountConflicts(generated.edges, completed));
+            CHECK(conflicts == graph.countConflicts());
+            CHECK(conflicts > 0);
+        }
+    }
+}
+
+int main() {
+    // Table d'adjacence seule, puis matrice de bits
+    checkPartialCol(generateRandomGraph(300, 0.05, 21), 3, 3000);
+    checkPartialCol(generateRandomGraph(200, 0.5, 22), 14, 3000);
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file TestUtils.h
+ * @brief Outils communs aux tests (enregistrés avec ctest) : vérification d'une condition et comptage des échecs.
+ */
+
+#ifndef TESTUTILS_H
+#define TESTUTILS_H
+
+#include <iostream>
+
+/**
+ * @brief Le nombre de vérifications échouées du test en cours, rendu par main comme code de retour.
+ */
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+/**
+ * @brief Vérifie une condition ; en cas d'échec, affiche la condition et sa position puis compte l'échec sans arrêter
+ * le test.
+ */
+#define CHECK(condition)                                                                                   \
+    do {                                                                                                   \
+        if (!(condition)) {                                                                                \
+            std::cerr << __FILE__ << ":" << __LINE__ << " : echec de " << #condition << std::endl;        \
+            testFailures()++;                                                                              \
+        }                                                                                                  \
+    } while (false)
+
+#endif
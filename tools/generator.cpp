@@ -0,0 +1,131 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <chrono>
+#include <filesystem>
+#include "../include/Graph.h"
+#include "../include/GraphLoader.h"
+#include "../include/GraphGenerator.h"
+
+
+/**
+ * @brief Écrit la coloration cachée d'un graphe généré, une ligne "noeud couleur" par noeud (numérotés à partir de 1),
+ * au format de l'option --output du programme principal.
+ * @param solutionFile Le fichier de sortie.
+ * @param planted La coloration cachée.
+ * @throw std::runtime_error si le fichier ne peut pas être ouvert.
+ */
+static void writePlantedColoring(const std::string& solutionFile, const std::vector<int>& planted) {
+    std::ofstream out(solutionFile);
+    if (!out) {
+        throw std::runtime_error("Impossible d'ouvrir le fichier de solution : " + solutionFile);
+    }
+    for (size_t v = 0; v < planted.size(); v++) {
+        out << v + 1 << " " << planted[v] + 1 << "\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        // Famille du graphe : "gnp" (DSJC), "leighton" ou "flat"
+        std::string type = "gnp";
+        int numNodes = -1;
+        // Densité, ou degré moyen visé (converti en densité selon la famille), -1 si absent
+        double p = -1;
+        double degree = -1;
+        // Nombre de classes de la coloration cachée (leighton et flat)
+        int k = 10;
+        // Graine fixe par défaut : deux appels identiques produisent le même fichier
+        unsigned long long seed = 1;
+        // Fichier du graphe (.col pour DIMACS, .csr pour le cache binaire) et de la coloration cachée
+        std::string outputFile;
+        std::string solutionFile;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--type" && i + 1 < argc) {
+                type = argv[i + 1];
+            }
+            if (arg == "--n" && i + 1 < argc) {
+                numNodes = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--p" && i + 1 < argc) {
+                p = std::stod(argv[i + 1]);
+            }
+            if (arg == "--degree" && i + 1 < argc) {
+                degree = std::stod(argv[i + 1]);
+            }
+            if (arg == "--k" && i + 1 < argc) {
+                k = std::stoi(argv[i + 1]);
+            }
+            if (arg == "--seed" && i + 1 < argc) {
+                seed = std::stoull(argv[i + 1]);
+            }
+            if (arg == "--output" && i + 1 < argc) {
+                outputFile = argv[i + 1];
+            }
+            if (arg == "--solution" && i + 1 < argc) {
+                solutionFile = argv[i + 1];
+            }
+        }
+
+        if (numNodes < 0 || outputFile.empty() || (p < 0) == (degree < 0)) {
+            std::cerr << "Utilisation : " << argv[0] << " --type gnp|leighton|flat --n <n> --p <densite>|--degree <d>"
+                      << " [--k <k>] [--seed <n>] --output <fichier.col|fichier.csr> [--solution <fichier>]"
+                      << std::endl;
+            return 1;
+        }
+        if (type != "gnp" && type != "leighton" && type != "flat") {
+            std::cerr << "Famille de graphes inconnue : " << type << std::endl;
+            return 1;
+        }
+        if (type == "gnp" && !solutionFile.empty()) {
+            std::cerr << "Un graphe G(n, p) n'a pas de coloration cachee (--solution)." << std::endl;
+            return 1;
+        }
+        if (degree >= 0) {
+            // Nombre de voisins possibles d'un noeud : tous les autres noeuds, ou ceux des autres classes
+            double candidates = type == "gnp" ? numNodes - 1.0 : numNodes - static_cast<double>(numNodes) / k;
+            p = candidates > 0 ? degree / candidates : 0;
+        }
+
+        auto start_time_generate = std::chrono::high_resolution_clock::now();
+        GeneratedGraph generated = generateGraph(type, numNodes, k, p, seed);
+        auto end_time_generate = std::chrono::high_resolution_clock::now();
+
+        std::ostringstream comment;
+        comment << "mh_generator --type " << type << " --n " << numNodes << " --p " << p;
+        if (type != "gnp") {
+            comment << " --k " << k;
+        }
+        comment << " --seed " << seed;
+        if (std::filesystem::path(outputFile).extension() == ".csr") {
+            Graph graph(generated.numNodes, generated.edges);
+            if (!writeGraphCache(graph, outputFile)) {
+                throw std::runtime_error("Impossible d'ecrire le cache binaire : " + outputFile);
+            }
+        } else {
+            writeDimacsFile(outputFile, generated.numNodes, generated.edges, comment.str());
+        }
+        if (!solutionFile.empty()) {
+            writePlantedColoring(solutionFile, generated.planted);
+        }
+        auto end_time_write = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Graphe " << type << " : " << generated.numNodes << " noeud(s), " << generated.edges.size()
+                  << " arete(s), degre moyen "
+                  << (generated.numNodes > 0 ? 2.0 * static_cast<double>(generated.edges.size()) / generated.numNodes
+                                             : 0.0)
+                  << ", densite " << p << std::endl;
+        std::cout << "Temps de generation : " << std::chrono::duration<double>(
+                end_time_generate - start_time_generate).count() << " secondes, temps d'ecriture : "
+                  << std::chrono::duration<double>(end_time_write - end_time_generate).count() << " secondes ("
+                  << outputFile << ")" << std::endl;
+
+    } catch (const std::exception &e) {
+        std::cerr << "Erreur : " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}